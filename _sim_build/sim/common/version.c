@@ -0,0 +1,2 @@
+#include "version.h"
+const char version[] = "12.0.50.20220216-git";
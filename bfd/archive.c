@@ -704,11 +704,12 @@ _bfd_get_elt_at_filepos (bfd *archive, file_ptr filepos,
 	    }
 	  n_bfd->proxy_origin = bfd_tell (archive);
 
-	  /* Copy BFD_COMPRESS, BFD_DECOMPRESS and BFD_COMPRESS_GABI
-	     flags.  */
+	  /* Copy BFD_COMPRESS, BFD_DECOMPRESS, BFD_COMPRESS_GABI and
+	     BFD_MMAP_CONTENTS flags.  */
 	  n_bfd->flags |= archive->flags & (BFD_COMPRESS
 					    | BFD_DECOMPRESS
-					    | BFD_COMPRESS_GABI);
+					    | BFD_COMPRESS_GABI
+					    | BFD_MMAP_CONTENTS);
 
 	  return n_bfd;
 	}
@@ -774,10 +775,12 @@ _bfd_get_elt_at_filepos (bfd *archive, file_ptr filepos,
 
   n_bfd->arelt_data = new_areldata;
 
-  /* Copy BFD_COMPRESS, BFD_DECOMPRESS and BFD_COMPRESS_GABI flags.  */
+  /* Copy BFD_COMPRESS, BFD_DECOMPRESS, BFD_COMPRESS_GABI and
+     BFD_MMAP_CONTENTS flags.  */
   n_bfd->flags |= archive->flags & (BFD_COMPRESS
 				    | BFD_DECOMPRESS
-				    | BFD_COMPRESS_GABI);
+				    | BFD_COMPRESS_GABI
+				    | BFD_MMAP_CONTENTS);
 
   /* Copy is_linker_input.  */
   n_bfd->is_linker_input = archive->is_linker_input;
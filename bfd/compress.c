@@ -175,10 +175,13 @@ bfd_compress_section_contents (bfd *abfd, sec_ptr sec,
     }
   else
     {
-      if (compress ((Bytef*) buffer + header_size,
-		    &compressed_size,
-		    (const Bytef*) uncompressed_buffer,
-		    uncompressed_size) != Z_OK)
+      int level = (abfd->compress_level != 0
+		   ? (int) abfd->compress_level : Z_DEFAULT_COMPRESSION);
+
+      if (compress2 ((Bytef*) buffer + header_size,
+		     &compressed_size,
+		     (const Bytef*) uncompressed_buffer,
+		     uncompressed_size, level) != Z_OK)
 	{
 	  bfd_release (abfd, buffer);
 	  bfd_set_error (bfd_error_bad_value);
@@ -365,6 +368,75 @@ bfd_get_full_section_contents (bfd *abfd, sec_ptr sec, bfd_byte **ptr)
     }
 }
 
+/*
+FUNCTION
+	bfd_map_section_contents
+
+SYNOPSIS
+	bool bfd_map_section_contents
+	  (bfd *abfd, asection *section, bfd_byte **ptr,
+	   void **map_addr, bfd_size_type *map_size);
+
+DESCRIPTION
+	Like @code{bfd_get_full_section_contents} with a NULL
+	@var{*ptr}, but map the contents of @var{section} read-only
+	from the file if @var{abfd} was opened with
+	@code{BFD_MMAP_CONTENTS} and they are stored there as is.
+	The contents must be released with
+	@code{bfd_unmap_section_contents}, passing the @var{*map_addr}
+	and @var{*map_size} set by this function.
+*/
+
+bool
+bfd_map_section_contents (bfd *abfd, sec_ptr sec, bfd_byte **ptr,
+			  void **map_addr, bfd_size_type *map_size)
+{
+  bfd_size_type sz;
+
+  *ptr = NULL;
+  *map_addr = NULL;
+  *map_size = 0;
+  if (abfd->direction != write_direction && sec->rawsize != 0)
+    sz = sec->rawsize;
+  else
+    sz = sec->size;
+
+  if (sec->compress_status == COMPRESS_SECTION_NONE
+      && (sec->flags & (SEC_HAS_CONTENTS | SEC_IN_MEMORY)) == SEC_HAS_CONTENTS
+      && (abfd->xvec->_bfd_get_section_contents
+	  == _bfd_generic_get_section_contents))
+    {
+      *ptr = _bfd_mmap_readonly (abfd, sec->filepos, sz, map_addr, map_size);
+      if (*ptr != NULL)
+	return true;
+    }
+
+  return bfd_get_full_section_contents (abfd, sec, ptr);
+}
+
+/*
+FUNCTION
+	bfd_unmap_section_contents
+
+SYNOPSIS
+	void bfd_unmap_section_contents
+	  (bfd_byte *contents, void *map_addr, bfd_size_type map_size);
+
+DESCRIPTION
+	Release @var{contents} returned by
+	@code{bfd_map_section_contents}.
+*/
+
+void
+bfd_unmap_section_contents (bfd_byte *contents, void *map_addr,
+			    bfd_size_type map_size)
+{
+  if (map_addr != NULL)
+    _bfd_munmap_readonly (map_addr, map_size);
+  else
+    free (contents);
+}
+
 /*
 FUNCTION
 	bfd_cache_section_contents
@@ -2498,6 +2498,8 @@ extern Elf_Internal_Rela *_bfd_elf_link_read_relocs
 extern Elf_Internal_Rela *_bfd_elf_link_info_read_relocs
   (bfd *, struct bfd_link_info *, asection *, void *, Elf_Internal_Rela *,
    bool);
+extern bool _bfd_elf_sort_relocs_by_offset
+  (Elf_Internal_Rela *, size_t);
 
 extern bool _bfd_elf_link_output_relocs
   (bfd *, asection *, Elf_Internal_Shdr *, Elf_Internal_Rela *,
@@ -339,32 +339,6 @@ _bfd_elf_strtab_emit (register bfd *abfd, struct elf_strtab_hash *tab)
   return true;
 }
 
-/* Compare two elf_strtab_hash_entry structures.  Called via qsort.
-   Won't ever return zero as all entries differ, so there is no issue
-   with qsort stability here.  */
-
-static int
-strrevcmp (const void *a, const void *b)
-{
-  struct elf_strtab_hash_entry *A = *(struct elf_strtab_hash_entry **) a;
-  struct elf_strtab_hash_entry *B = *(struct elf_strtab_hash_entry **) b;
-  unsigned int lenA = A->len;
-  unsigned int lenB = B->len;
-  const unsigned char *s = (const unsigned char *) A->root.string + lenA - 1;
-  const unsigned char *t = (const unsigned char *) B->root.string + lenB - 1;
-  int l = lenA < lenB ? lenA : lenB;
-
-  while (l)
-    {
-      if (*s != *t)
-	return (int) *s - (int) *t;
-      s--;
-      t--;
-      l--;
-    }
-  return lenA - lenB;
-}
-
 static inline int
 is_suffix (const struct elf_strtab_hash_entry *A,
 	   const struct elf_strtab_hash_entry *B)
@@ -384,14 +358,15 @@ is_suffix (const struct elf_strtab_hash_entry *A,
 void
 _bfd_elf_strtab_finalize (struct elf_strtab_hash *tab)
 {
-  struct elf_strtab_hash_entry **array, **a, *e;
+  struct elf_strtab_hash_entry *e;
+  struct bfd_revstr *array, *a;
   bfd_size_type amt, sec_size;
   size_t size, i;
 
   /* Sort the strings by suffix and length.  */
   amt = tab->size;
-  amt *= sizeof (struct elf_strtab_hash_entry *);
-  array = (struct elf_strtab_hash_entry **) bfd_malloc (amt);
+  amt *= sizeof (struct bfd_revstr);
+  array = (struct bfd_revstr *) bfd_malloc (amt);
   if (array == NULL)
     goto alloc_failure;
 
@@ -400,9 +375,12 @@ _bfd_elf_strtab_finalize (struct elf_strtab_hash *tab)
       e = tab->array[i];
       if (e->refcount)
 	{
-	  *a++ = e;
 	  /* Adjust the length to not include the zero terminator.  */
 	  e->len -= 1;
+	  a->end = (const unsigned char *) e->root.string + e->len;
+	  a->len = e->len;
+	  a->entry = e;
+	  a++;
 	}
       else
 	e->len = 0;
@@ -411,7 +389,7 @@ _bfd_elf_strtab_finalize (struct elf_strtab_hash *tab)
   size = a - array;
   if (size != 0)
     {
-      qsort (array, size, sizeof (struct elf_strtab_hash_entry *), strrevcmp);
+      _bfd_sort_reversed_strings (array, size);
 
       /* Loop over the sorted array and merge suffixes.  Start from the
 	 end because we want eg.
@@ -427,11 +405,12 @@ _bfd_elf_strtab_finalize (struct elf_strtab_hash *tab)
 	 s1 _______^
 
 	 ie. we don't want s1 pointing into the old s2.  */
-      e = *--a;
+      e = (struct elf_strtab_hash_entry *) (--a)->entry;
       e->len += 1;
       while (--a >= array)
 	{
-	  struct elf_strtab_hash_entry *cmp = *a;
+	  struct elf_strtab_hash_entry *cmp
+	    = (struct elf_strtab_hash_entry *) a->entry;
 
 	  cmp->len += 1;
 	  if (is_suffix (e, cmp))
@@ -2519,68 +2519,6 @@ nds32_put_trampoline (void *contents, const unsigned long *template,
     }
 }
 
-/* nds32_insertion_sort sorts an array with nmemb elements of size size.
-   This prototype is the same as qsort ().  */
-
-static void
-nds32_insertion_sort (void *base, size_t nmemb, size_t size,
-		      int (*compar) (const void *lhs, const void *rhs))
-{
-  char *ptr = (char *) base;
-  int i, j;
-  char tmp[sizeof (Elf_Internal_Rela)];
-
-  BFD_ASSERT (size <= sizeof (tmp));
-
-  /* If i is less than j, i is inserted before j.
-
-     |---- j ----- i --------------|
-      \		 / \		  /
-	 sorted		unsorted
-   */
-
-  for (i = 1; i < (int) nmemb; i++)
-    {
-      for (j = (i - 1); j >= 0; j--)
-	if (compar (ptr + i * size, ptr + j * size) >= 0)
-	  break;
-
-      j++;
-
-      if (i == j)
-	continue; /* i is in order.  */
-
-      memcpy (tmp, ptr + i * size, size);
-      memmove (ptr + (j + 1) * size, ptr + j * size, (i - j) * size);
-      memcpy (ptr + j * size, tmp, size);
-    }
-}
-
-/* Sort relocation by r_offset.
-
-   We didn't use qsort () in stdlib, because quick-sort is not a stable sorting
-   algorithm.  Relocations at the same r_offset must keep their order.
-   For example, RELAX_ENTRY must be the very first relocation entry.
-
-   Currently, this function implements insertion-sort.
-
-   FIXME: If we already sort them in assembler, why bother sort them
-	  here again?  */
-
-static int
-compar_reloc (const void *lhs, const void *rhs)
-{
-  const Elf_Internal_Rela *l = (const Elf_Internal_Rela *) lhs;
-  const Elf_Internal_Rela *r = (const Elf_Internal_Rela *) rhs;
-
-  if (l->r_offset > r->r_offset)
-    return 1;
-  else if (l->r_offset == r->r_offset)
-    return 0;
-  else
-    return -1;
-}
-
 /* Functions listed below are only used for old relocs.
      nds32_elf_9_pcrel_reloc
      nds32_elf_do_9_pcrel_reloc
@@ -11809,8 +11747,8 @@ nds32_relax_adjust_label (bfd *abfd, asection *sec,
 
   /* Checking for branch relaxation relies on the relocations to
      be sorted on 'r_offset'.  This is not guaranteed so we must sort.  */
-  nds32_insertion_sort (internal_relocs, sec->reloc_count,
-			sizeof (Elf_Internal_Rela), compar_reloc);
+  if (!_bfd_elf_sort_relocs_by_offset (internal_relocs, sec->reloc_count))
+    return false;
 
   irelend = internal_relocs + sec->reloc_count;
 
@@ -2623,7 +2623,9 @@ _bfd_elf_link_assign_sym_version (struct elf_link_hash_entry *h, void *data)
    translated into RELA relocations and stored in INTERNAL_RELOCS,
    which should have already been allocated to contain enough space.
    The EXTERNAL_RELOCS are a buffer where the external form of the
-   relocations should be stored.
+   relocations should be stored.  If EXTERNAL_RELOCS is NULL, the
+   relocations are mapped from the file when possible, else read into
+   a temporary buffer.
 
    Returns FALSE if something goes wrong.  */
 
@@ -2641,14 +2643,29 @@ elf_link_read_relocs_from_section (bfd *abfd,
   Elf_Internal_Rela *irela;
   Elf_Internal_Shdr *symtab_hdr;
   size_t nsyms;
+  void *alloc = NULL;
+  void *map_addr = NULL;
+  bfd_size_type map_size = 0;
+  bool ret = false;
 
-  /* Position ourselves at the start of the section.  */
-  if (bfd_seek (abfd, shdr->sh_offset, SEEK_SET) != 0)
-    return false;
+  if (external_relocs == NULL)
+    {
+      external_relocs = _bfd_mmap_readonly (abfd, shdr->sh_offset,
+					    shdr->sh_size, &map_addr,
+					    &map_size);
+      if (external_relocs == NULL)
+	{
+	  external_relocs = alloc = bfd_malloc (shdr->sh_size);
+	  if (alloc == NULL)
+	    return false;
+	}
+    }
 
-  /* Read the relocations.  */
-  if (bfd_bread (external_relocs, shdr->sh_size, abfd) != shdr->sh_size)
-    return false;
+  /* Read the relocations, unless they are mapped.  */
+  if (map_addr == NULL
+      && (bfd_seek (abfd, shdr->sh_offset, SEEK_SET) != 0
+	  || bfd_bread (external_relocs, shdr->sh_size, abfd) != shdr->sh_size))
+    goto out;
 
   symtab_hdr = &elf_tdata (abfd)->symtab_hdr;
   nsyms = NUM_SHDR_ENTRIES (symtab_hdr);
@@ -2663,7 +2680,7 @@ elf_link_read_relocs_from_section (bfd *abfd,
   else
     {
       bfd_set_error (bfd_error_wrong_format);
-      return false;
+      goto out;
     }
 
   erela = (const bfd_byte *) external_relocs;
@@ -2690,7 +2707,7 @@ elf_link_read_relocs_from_section (bfd *abfd,
 		 abfd, (uint64_t) r_symndx, (unsigned long) nsyms,
 		 (uint64_t) irela->r_offset, sec);
 	      bfd_set_error (bfd_error_bad_value);
-	      return false;
+	      goto out;
 	    }
 	}
       else if (r_symndx != STN_UNDEF)
@@ -2703,13 +2720,18 @@ elf_link_read_relocs_from_section (bfd *abfd,
 	     abfd, (uint64_t) r_symndx,
 	     (uint64_t) irela->r_offset, sec);
 	  bfd_set_error (bfd_error_bad_value);
-	  return false;
+	  goto out;
 	}
       irela += bed->s->int_rels_per_ext_rel;
       erela += shdr->sh_entsize;
     }
+  ret = true;
 
-  return true;
+ out:
+  if (map_addr != NULL)
+    _bfd_munmap_readonly (map_addr, map_size);
+  free (alloc);
+  return ret;
 }
 
 /* Read and swap the relocs for a section O.  They may have been
@@ -2731,7 +2753,6 @@ _bfd_elf_link_info_read_relocs (bfd *abfd,
 				Elf_Internal_Rela *internal_relocs,
 				bool keep_memory)
 {
-  void *alloc1 = NULL;
   Elf_Internal_Rela *alloc2 = NULL;
   const struct elf_backend_data *bed = get_elf_backend_data (abfd);
   struct bfd_elf_section_data *esdo = elf_section_data (o);
@@ -2760,21 +2781,8 @@ _bfd_elf_link_info_read_relocs (bfd *abfd,
 	goto error_return;
     }
 
-  if (external_relocs == NULL)
-    {
-      bfd_size_type size = 0;
-
-      if (esdo->rel.hdr)
-	size += esdo->rel.hdr->sh_size;
-      if (esdo->rela.hdr)
-	size += esdo->rela.hdr->sh_size;
-
-      alloc1 = bfd_malloc (size);
-      if (alloc1 == NULL)
-	goto error_return;
-      external_relocs = alloc1;
-    }
-
+  /* Without EXTERNAL_RELOCS, each reloc section is mapped or read into
+     a buffer of its own.  */
   internal_rela_relocs = internal_relocs;
   if (esdo->rel.hdr)
     {
@@ -2782,8 +2790,9 @@ _bfd_elf_link_info_read_relocs (bfd *abfd,
 					      external_relocs,
 					      internal_relocs))
 	goto error_return;
-      external_relocs = (((bfd_byte *) external_relocs)
-			 + esdo->rel.hdr->sh_size);
+      if (external_relocs != NULL)
+	external_relocs = (((bfd_byte *) external_relocs)
+			   + esdo->rel.hdr->sh_size);
       internal_rela_relocs += (NUM_SHDR_ENTRIES (esdo->rel.hdr)
 			       * bed->s->int_rels_per_ext_rel);
     }
@@ -2798,15 +2807,12 @@ _bfd_elf_link_info_read_relocs (bfd *abfd,
   if (keep_memory)
     esdo->relocs = internal_relocs;
 
-  free (alloc1);
-
   /* Don't free alloc2, since if it was allocated we are passing it
      back (under the name of internal_relocs).  */
 
   return internal_relocs;
 
  error_return:
-  free (alloc1);
   if (alloc2 != NULL)
     {
       if (keep_memory)
@@ -2833,6 +2839,60 @@ _bfd_elf_link_read_relocs (bfd *abfd,
 
 }
 
+/* Sort the COUNT relocs in RELOCS by r_offset.  The sort is stable, since
+   relocs at the same r_offset must keep their order, and the common case
+   of relocs which are already in order is detected in a single pass.
+   Return FALSE on memory allocation failure.  */
+
+bool
+_bfd_elf_sort_relocs_by_offset (Elf_Internal_Rela *relocs, size_t count)
+{
+  Elf_Internal_Rela *buf, *src, *dst, *tmp;
+  size_t i, width;
+
+  for (i = 1; i < count; i++)
+    if (relocs[i].r_offset < relocs[i - 1].r_offset)
+      break;
+  if (i >= count)
+    return true;
+
+  buf = (Elf_Internal_Rela *) bfd_malloc (count * sizeof (*buf));
+  if (buf == NULL)
+    return false;
+
+  /* Bottom-up merge sort, taking the left run on ties.  */
+  src = relocs;
+  dst = buf;
+  for (width = 1; width < count; width *= 2)
+    {
+      size_t lo;
+
+      for (lo = 0; lo < count; lo += 2 * width)
+	{
+	  size_t mid = lo + width < count ? lo + width : count;
+	  size_t hi = mid + width < count ? mid + width : count;
+	  size_t l = lo, r = mid, k = lo;
+
+	  while (l < mid && r < hi)
+	    dst[k++] = (src[r].r_offset < src[l].r_offset
+			? src[r++] : src[l++]);
+	  while (l < mid)
+	    dst[k++] = src[l++];
+	  while (r < hi)
+	    dst[k++] = src[r++];
+	}
+
+      tmp = src;
+      src = dst;
+      dst = tmp;
+    }
+
+  if (src != relocs)
+    memcpy (relocs, src, count * sizeof (*relocs));
+  free (buf);
+  return true;
+}
+
 /* Compute the size of, and allocate space for, REL_HDR which is the
    section header for a section containing relocations for O.  */
 
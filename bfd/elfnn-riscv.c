@@ -67,7 +67,7 @@ ELFNN_R_TYPE (R_RISCV_DELETE) != R_RISCV_DELETE for 32-bit toolchains
 #define RISCV_ATTRIBUTES_SECTION_NAME ".riscv.attributes"
 
 /* Helper functions for Rom Patch and ICT.  */
-static void riscv_elf_ict_init (void);
+static bool riscv_elf_ict_init (void);
 static void andes_relocate_ict_table (struct bfd_link_info *, bfd *);
 static void andes_complement_ict_symbols (struct bfd_link_info *info);
 
@@ -154,9 +154,6 @@ struct riscv_elf_link_hash_table
 };
 #endif
 
-/* debug use */
-#define ZCMT_PRINT_TABLE_JUMP_ENTRIES 0
-
 /* Instruction access functions. */
 #define riscv_get_insn(bits, ptr)		\
   ((bits) == 16 ? bfd_getl16 (ptr)		\
@@ -192,13 +189,9 @@ riscv_elf_execit_reloc_insn (execit_itable_t *ptr,
 static bfd_vma
 riscv_elf_encode_relocation (bfd *abfd,
 			     Elf_Internal_Rela *irel, bfd_vma relocation);
-static void
-riscv_insertion_sort (void *base, size_t nmemb, size_t size,
-		      int (*compar) (const void *lhs, const void *rhs));
 static int
-compar_reloc (const void *lhs, const void *rhs);
-static int
-andes_relax_gp_insn (uint32_t *insn, Elf_Internal_Rela *rel,
+andes_relax_gp_insn (andes_linker_state_t *nsta,
+		     uint32_t *insn, Elf_Internal_Rela *rel,
 		     riscv_pcgp_hi_reloc_t *hi, asection *sym_sec,
 		     bfd_vma symval, bfd_vma gp, bfd_vma data_start);
 static bool
@@ -208,7 +201,7 @@ andes_relax_execit_ite (
   bfd *abfd,
   asection *sec,
   asection *sym_sec ATTRIBUTE_UNUSED,
-  struct bfd_link_info *info ATTRIBUTE_UNUSED,
+  struct bfd_link_info *info,
   Elf_Internal_Rela *rel,
   bfd_vma symval,
   bfd_vma max_alignment,
@@ -241,10 +234,6 @@ typedef struct relax_gp_sym_info
   struct relax_gp_sym_info *next;
 } relax_gp_sym_info_t;
 
-static relax_gp_sym_info_t *relax_gp_sym_info_head = NULL;
-static execit_state_t execit;
-static ict_state_t ict;
-static andes_linker_state_t nsta = {.opt = NULL};
 extern andes_ict_state_t nds_ict_sta;
 /* } Andes */
 
@@ -444,12 +433,12 @@ riscv_free_table_jump_htab (riscv_table_jump_htab_t *htab)
 }
 
 static bool
-riscv_update_table_jump_entry (htab_t htab,
+riscv_update_table_jump_entry (riscv_table_jump_htab_t *tbj,
+			       htab_t htab,
 			       bfd_vma addr,
 			       unsigned int benefit,
 			       const char *name)
 {
-  static int id = 0;
   riscv_table_jump_htab_entry search = {.address = addr};
   riscv_table_jump_htab_entry *entry = htab_find (htab, &search);
 
@@ -467,7 +456,7 @@ riscv_update_table_jump_entry (htab_t htab,
       if (*slot == NULL)
 	return false;
 
-      (*slot)->id = ++id;
+      (*slot)->id = ++tbj->last_id;
       (*slot)->address = addr;
       (*slot)->benefit = benefit;
       (*slot)->name = name;
@@ -542,24 +531,6 @@ riscv_elf_get_local_sym_hash (struct riscv_elf_link_hash_table *htab,
   return &ret->elf;
 }
 
-#if ZCMT_PRINT_TABLE_JUMP_ENTRIES
-static void
-print_tablejump_entries(riscv_table_jump_htab_t *table_jump_htab)
-{
-  if (table_jump_htab->tbj_indexes[0])
-    printf("cm.jt:\n");
-  for (unsigned int z = 0; z < 64 && table_jump_htab->tbj_indexes[z] != 0; z ++)
-    printf ("\tindex=%d, sym name=%s, address=0x%08lx, savings=%u\n",
-	z, table_jump_htab->names[z], table_jump_htab->tbj_indexes[z], table_jump_htab->savings[z]);
-
-  if (table_jump_htab->tbj_indexes[64])
-    printf("cm.jalt:\n");
-  for (unsigned int z = 64; z < 256 && table_jump_htab->tbj_indexes[z] != 0; z ++)
-    printf ("\tindex=%d, sym name=%s, address=0x%08lx, savings=%u\n",
-	z, table_jump_htab->names[z], table_jump_htab->tbj_indexes[z], table_jump_htab->savings[z]);
-}
-#endif
-
 /* Destroy a RISC-V elf linker hash table.  */
 
 static void
@@ -572,12 +543,16 @@ riscv_elf_link_hash_table_free (bfd *obfd)
     htab_delete (ret->loc_hash_table);
   if (ret->loc_hash_memory)
     objalloc_free ((struct objalloc *) ret->loc_hash_memory);
+  if (ret->execit.scan_cache)
+    htab_delete (ret->execit.scan_cache);
+  if (ret->ict_init)
+    {
+      bfd_hash_table_free (&nds_ict_sta.indirect_call_table);
+      nds_ict_sta.hash_entries = 0;
+    }
 
   if (ret->table_jump_htab)
     {
-#if ZCMT_PRINT_TABLE_JUMP_ENTRIES
-      print_tablejump_entries(ret->table_jump_htab);
-#endif
       riscv_free_table_jump_htab (ret->table_jump_htab);
       free (ret->table_jump_htab);
     }
@@ -616,6 +591,8 @@ riscv_elf_link_hash_table_create (bfd *abfd)
     }
 
   ret->max_alignment = (bfd_vma) -1;
+  ret->execit.htab = ret;
+  ret->nsta.opt = &ret->andes;
 
   /* Create hash table for local ifunc.  */
   ret->loc_hash_table = htab_try_create (1024,
@@ -628,6 +605,17 @@ riscv_elf_link_hash_table_create (bfd *abfd)
       riscv_elf_link_hash_table_free (abfd);
       return NULL;
     }
+
+  /* { Andes */
+  /* Build the ict hash table to store all global symbols attached
+     with ICT suffix.  */
+  if (!riscv_elf_ict_init ())
+    {
+      riscv_elf_link_hash_table_free (abfd);
+      return NULL;
+    }
+  ret->ict_init = 1;
+  /* } Andes */
   ret->elf.root.hash_table_free = riscv_elf_link_hash_table_free;
 
   return &ret->elf.root;
@@ -972,9 +960,8 @@ riscv_elf_check_relocs (bfd *abfd, struct bfd_link_info *info,
 
   htab = riscv_elf_hash_table (info);
 
-  static int is_inited = false;
-  if (! is_inited) { /*Andes */
-    is_inited = true;
+  if (! htab->check_relocs_init) { /*Andes */
+    htab->check_relocs_init = true;
 
     andes_ld_options_t *andes = &htab->andes;
     /* determine table jump enable:
@@ -993,7 +980,7 @@ riscv_elf_check_relocs (bfd *abfd, struct bfd_link_info *info,
 	  }
       }
     andes->set_table_jump = (uint) determine;
-    nsta.use_table_jump = ena_zcmt ? 1 : 0;
+    htab->nsta.use_table_jump = ena_zcmt ? 1 : 0;
     /* create section at "riscv_elf_after_check_relocs".  */
   } /* Andes */
 
@@ -2476,7 +2463,6 @@ riscv_elf_relocate_section (bfd *output_bfd,
 			    Elf_Internal_Sym *local_syms,
 			    asection **local_sections)
 {
-  static bool is_ict_fini = false;
   Elf_Internal_Rela *rel;
   Elf_Internal_Rela *relend;
   riscv_pcrel_relocs pcrel_relocs;
@@ -2492,7 +2478,8 @@ riscv_elf_relocate_section (bfd *output_bfd,
 
   /* { Andes */
   andes_ld_options_t *andes = &htab->andes;
-  if (execit.is_itb_base_set == 0)
+  execit_state_t *execit = &htab->execit;
+  if (execit->is_itb_base_set == 0)
     { /* Set the _ITB_BASE_.  */
       if (! execit_set_itb_base (info))
 	{
@@ -2503,20 +2490,20 @@ riscv_elf_relocate_section (bfd *output_bfd,
 
     }
 
-  if (execit.is_itable_relocated == 0)
+  if (execit->is_itable_relocated == 0)
     { /* init itable before relocating ITE.  */
       if (andes->target_optimization & RISCV_RELAX_EXECIT_ON)
 	andes_execit_relocate_itable (info);
-      execit.is_itable_relocated = 1;
+      execit->is_itable_relocated = 1;
     }
 
   /* if ict table existed, then assuming all jobs have done.  */
-  if (!is_ict_fini && !find_imported_ict_table && nds_ict_sta.list_len)
+  if (!htab->ict_fini && !find_imported_ict_table && nds_ict_sta.list_len)
     {
       andes_complement_ict_symbols (info);
       andes_relocate_ict_table (info, output_bfd);
     }
-  is_ict_fini = true;
+  htab->ict_fini = 1;
   /* } Andes */
 
   relend = relocs + input_section->reloc_count;
@@ -3434,11 +3421,11 @@ riscv_elf_relocate_section (bfd *output_bfd,
 		bfd_vma index = relx->tag;
 		relx->saved_irel.r_offset = rel->r_offset;
 		relx->saved_irel.r_addend = rel->r_addend;
-		andes_relax_execit_ite (input_bfd, input_section, NULL, NULL,
+		andes_relax_execit_ite (input_bfd, input_section, NULL, info,
 		  &relx->saved_irel, relocation, index, 0, NULL, NULL, false);
 
 		/* record R_RISCV_PCREL_HI20 for pals.  */
-		execit_hash_t *he = execit.itable_array[index].he;
+		execit_hash_t *he = execit->itable_array[index].he;
 		int rtype = ELFNN_R_TYPE (he->ie.irel_copy.r_info);
 		if (rtype == R_RISCV_CALL || rtype == R_RISCV_PCREL_HI20)
 		  rtype = ELFNN_R_TYPE (rel->r_info);
@@ -4294,8 +4281,10 @@ riscv_add_arch_attr_subset (char *arch, char *subset, uint state)
 /* Merge Tag_RISCV_arch attribute.  */
 
 static char *
-riscv_merge_arch_attr_info (bfd *ibfd, char *in_arch, char *out_arch)
+riscv_merge_arch_attr_info (bfd *ibfd, struct bfd_link_info *info,
+			    char *in_arch, char *out_arch)
 {
+  andes_ld_options_t *andes = &riscv_elf_hash_table (info)->andes;
   riscv_subset_t *in, *out;
   char *merged_arch_str;
   unsigned xlen_in, xlen_out;
@@ -4309,8 +4298,7 @@ riscv_merge_arch_attr_info (bfd *ibfd, char *in_arch, char *out_arch)
     riscv_release_subset_list (&merged_subsets);
   BFD_ASSERT (merged_subsets.tail == NULL);
 
-  BFD_ASSERT (nsta.opt);
-  bool enabled_execit = nsta.opt->target_optimization & RISCV_RELAX_EXECIT_ON;
+  bool enabled_execit = andes->target_optimization & RISCV_RELAX_EXECIT_ON;
   riscv_parse_subset_t riscv_rps_ld_in =
     {&in_subsets, _bfd_error_handler, _bfd_error_handler, &xlen_in, NULL, false,
      STATE_LINK, enabled_execit};
@@ -4451,7 +4439,7 @@ riscv_merge_attributes (bfd *ibfd, struct bfd_link_info *info)
 	{
 	  char buf[0x100];
 	  char *merged_arch = out_attr[Tag_RISCV_arch].s;
-	  if (nsta.opt->execit_flags.nexecit_op)
+	  if (riscv_elf_hash_table (info)->andes.execit_flags.nexecit_op)
 	    {
 	      char *us = strstr (merged_arch, "_");
 	      if (us)
@@ -4464,7 +4452,7 @@ riscv_merge_attributes (bfd *ibfd, struct bfd_link_info *info)
 	    }
 
 	  merged_arch =
-		riscv_merge_arch_attr_info (ibfd,
+		riscv_merge_arch_attr_info (ibfd, info,
 					    out_attr[Tag_RISCV_arch].s,
 					    merged_arch);
 	    if (merged_arch == NULL)
@@ -4494,7 +4482,7 @@ riscv_merge_attributes (bfd *ibfd, struct bfd_link_info *info)
 	  {
 	    /* Check compatible.  */
 	    char *merged_arch =
-		riscv_merge_arch_attr_info (ibfd,
+		riscv_merge_arch_attr_info (ibfd, info,
 					    in_attr[Tag_RISCV_arch].s,
 					    out_attr[Tag_RISCV_arch].s);
 	    if (merged_arch == NULL)
@@ -4707,16 +4695,6 @@ _bfd_riscv_elf_merge_private_bfd_data (bfd *ibfd, struct bfd_link_info *info)
   bfd *obfd = info->output_bfd;
   flagword new_flags, old_flags;
 
-  /* { Andes  */
-  /* TODO: init `andes' ASAP in better timing. */
-  if (nsta.opt == NULL)
-    {
-      struct riscv_elf_link_hash_table *htab = riscv_elf_hash_table (info);
-      memset (&nsta, 0, sizeof (nsta));
-      nsta.opt = &htab->andes;
-    }
-  /* } Andes  */
-
   if (!is_riscv_elf (ibfd) || !is_riscv_elf (obfd))
     return true;
 
@@ -4816,6 +4794,8 @@ struct riscv_pcgp_hi_reloc
   asection *sym_sec;
   bool undefined_weak;
   riscv_pcgp_hi_reloc *next;
+  /* The older relocs at the same HI_SEC_OFF, chained in the index.  */
+  riscv_pcgp_hi_reloc *same;
   /* { Andes */
   Elf_Internal_Rela *rel;
   int is_deleted:1;
@@ -4835,6 +4815,21 @@ typedef struct
 {
   riscv_pcgp_hi_reloc *hi;
   riscv_pcgp_lo_reloc *lo;
+  /* HI and LO indexed by hi_sec_off.  Deleting bytes only marks them
+     stale, and they are rebuilt by the next lookup.  */
+  htab_t hi_index;
+  htab_t lo_index;
+  bool stale;
+  /* { Andes  */
+  /* The rest is the state of the section being relaxed, which reaches
+     every relax function along with the pcgp relocs.  */
+  /* Byte deletions deferred until the end of the current relax pass.  */
+  struct riscv_relax_delete_ranges *pending_delete;
+  /* Symbols defined in the section, sorted by address.  */
+  struct riscv_relax_sym_index *sym_index;
+  /* End of the last code alignment, for the target alignment.  */
+  bfd_vma prev_aligned_offset;
+  /* } Andes  */
 } riscv_pcgp_relocs;
 
 /* { Andes  */
@@ -4871,7 +4866,7 @@ _bfd_riscv_relax_align_btb (bfd *abfd, asection *sec,
 			    bfd_vma max_alignment ATTRIBUTE_UNUSED,
 			    bfd_vma reserve_size ATTRIBUTE_UNUSED,
 			    bool *again ATTRIBUTE_UNUSED,
-			    riscv_pcgp_relocs *pcgp_relocs ATTRIBUTE_UNUSED,
+			    riscv_pcgp_relocs *pcgp_relocs,
 			    bool undefined_weak ATTRIBUTE_UNUSED);
 static bool
 _bfd_riscv_relax_lui_gp_insn (bfd *abfd, asection *sec, asection *sym_sec,
@@ -4892,20 +4887,28 @@ static int
 riscv_get_local_syms (const bfd *abfd, asection *sec ATTRIBUTE_UNUSED,
 		      Elf_Internal_Sym **isymbuf_p);
 static bool
-execit_check_pchi_for_jal (bfd_vma relocation, bfd_vma insn_pc);
+execit_check_pchi_for_jal (const execit_state_t *execit, bfd_vma relocation,
+			   bfd_vma insn_pc);
 static bfd_vma
 riscv_data_start_value (const struct bfd_link_info *info);
 static bool
 andes_execit_hash_insn (bfd *abfd, asection *sec,
 			struct bfd_link_info *link_info);
+static uint32_t
+andes_execit_scan_options (const andes_ld_options_t *andes);
+static void
+andes_execit_save_cache (execit_state_t *execit, const char *name,
+			 uint32_t options);
 static void
-andes_execit_traverse_insn_hash (int (*func) (execit_hash_t*));
+andes_execit_traverse_insn_hash (execit_state_t *execit,
+				 int (*func) (execit_state_t *,
+					      execit_hash_t *));
 static int
-andes_execit_rank_insn (execit_hash_t *he);
+andes_execit_rank_insn (execit_state_t *execit, execit_hash_t *he);
 static int
-andes_execit_rank_imported_insn (execit_hash_t *he);
+andes_execit_rank_imported_insn (execit_state_t *execit, execit_hash_t *he);
 static int
-andes_execit_free (execit_hash_t *he);
+andes_execit_free (execit_state_t *execit, execit_hash_t *he);
 static void
 andes_execit_build_itable (struct bfd_link_info *info);
 static bool
@@ -4914,12 +4917,12 @@ andes_execit_replace_insn (struct bfd_link_info *link_info,
 static void
 andes_execit_delete_blank (struct bfd_link_info *info);
 static asection*
-andes_execit_get_itable_section (bfd *input_bfds);
+andes_execit_get_itable_section (struct bfd_link_info *info);
 static bool
 andes_execit_deal_phase (struct bfd_link_info *info, asection *sec,
 			 bool *again);
 static void
-andes_execit_reset (bool *again);
+andes_execit_reset (execit_state_t *execit, bool *again);
 #if 0
 static asection*
 andes_table_jump_get_section (struct bfd_link_info *info);
@@ -4955,7 +4958,7 @@ static void
 andes_execit_estimate_lui (execit_hash_t *he, execit_vma_t **lst_pp);
 #endif
 static void
-andes_execit_estimate_hi20 (execit_hash_t *he);
+andes_execit_estimate_hi20 (execit_state_t *execit, execit_hash_t *he);
 static int
 rank_each_cb (void *l ATTRIBUTE_UNUSED, execit_rank_t *j, execit_rank_t *p,
 	      void *q ATTRIBUTE_UNUSED);
@@ -4982,7 +4985,8 @@ andes_execit_itable_lookup (execit_context_t *ctx,
 static bool
 execit_push_blank (execit_context_t *ctx, bfd_vma delta, bfd_vma size);
 static bool
-andes_execit_mark_irel (Elf_Internal_Rela *irel, int index);
+andes_execit_mark_irel (execit_state_t *execit, Elf_Internal_Rela *irel,
+			int index);
 static andes_irelx_t*
 andes_extend_irel (Elf_Internal_Rela *irel, int subtype,
 		   andes_irelx_t **list);
@@ -5010,44 +5014,137 @@ riscv_mark_pcgp_hi_reloc (riscv_pcgp_relocs *p, riscv_pcgp_hi_reloc *hi,
 static void
 andes_relax_pc_gp_insn_final (riscv_pcgp_relocs *p);
 
-/* Exec.it hash function.  */
+/* Exec.it hash functions.  */
 
-static struct bfd_hash_entry *
-riscv_elf_code_hash_newfunc (struct bfd_hash_entry *entry,
-			     struct bfd_hash_table *table,
-			     const char *string ATTRIBUTE_UNUSED)
+static hashval_t
+andes_execit_hash_key (const execit_hash_key_t *key)
 {
-  static int id = 0;
-  const size_t sz_entry = sizeof (execit_hash_t);
-  const size_t sz_head = sizeof (struct bfd_hash_entry);
-  const size_t sz_body = sz_entry - sz_head;
+  hashval_t h = iterative_hash_object (key->fixed, 0);
+  h = iterative_hash_object (key->symbol, h);
+  h = iterative_hash_object (key->rel_section, h);
+  return iterative_hash_object (key->rel_offset, h);
+}
 
-  /* Allocate the structure if it has not already been
-     allocated by a subclass.  */
-  if (entry == NULL)
+static inline execit_hash_t *
+andes_execit_hash_entry (const execit_code_hash_t *t, unsigned int id)
+{
+  return t->blocks[id / EXECIT_POOL_BLOCK]
+	 + id % EXECIT_POOL_BLOCK;
+}
+
+/* Initialize the exec.it code hash T with SIZE slots.  */
+
+static bool
+andes_execit_hash_init (execit_code_hash_t *t, unsigned int size)
+{
+  memset (t, 0, sizeof (*t));
+  t->slots = bfd_zmalloc (size * sizeof (*t->slots));
+  if (t->slots == NULL)
+    return false;
+  t->size = size;
+  return true;
+}
+
+/* Free the exec.it code hash T.  */
+
+static void
+andes_execit_hash_free (execit_code_hash_t *t)
+{
+  unsigned int i;
+
+  for (i = 0; i * EXECIT_POOL_BLOCK < t->count; i++)
+    free (t->blocks[i]);
+  free (t->blocks);
+  free (t->slots);
+  memset (t, 0, sizeof (*t));
+}
+
+/* Double the slots of the exec.it code hash T.  */
+
+static bool
+andes_execit_hash_expand (execit_code_hash_t *t)
+{
+  unsigned int size = t->size * 2;
+  unsigned int *slots = bfd_zmalloc (size * sizeof (*slots));
+  unsigned int i;
+
+  if (slots == NULL)
+    return false;
+
+  for (i = 0; i < t->count; i++)
     {
-      entry = (void *)
-	bfd_hash_allocate (table, sz_entry);
+      unsigned int k = andes_execit_hash_entry (t, i)->hash & (size - 1);
+      while (slots[k] != 0)
+	k = (k + 1) & (size - 1);
+      slots[k] = i + 1;
+    }
 
-      if (entry == NULL)
-	return entry;
+  free (t->slots);
+  t->slots = slots;
+  t->size = size;
+  return true;
+}
+
+/* Look up KEY in the exec.it code hash T, and create a new zeroed entry
+   for it if CREATE and not found.  */
+
+static execit_hash_t *
+andes_execit_hash_lookup (execit_code_hash_t *t, const execit_hash_key_t *key,
+			  bool create)
+{
+  hashval_t hash = andes_execit_hash_key (key);
+  unsigned int k = hash & (t->size - 1);
+  execit_hash_t *he;
+
+  for (; t->slots[k] != 0; k = (k + 1) & (t->size - 1))
+    {
+      he = andes_execit_hash_entry (t, t->slots[k] - 1);
+      if (he->hash == hash
+	  && he->key.fixed == key->fixed
+	  && he->key.symbol == key->symbol
+	  && he->key.rel_section == key->rel_section
+	  && he->key.rel_offset == key->rel_offset)
+	return he;
     }
 
-  memset ((void *) entry + sz_head, 0, sz_body);
-  ((execit_hash_t*) entry)->id = id++;
+  if (!create)
+    return NULL;
 
-  return entry;
+  if (t->count % EXECIT_POOL_BLOCK == 0)
+    {
+      unsigned int nblocks = t->count / EXECIT_POOL_BLOCK;
+      execit_hash_t **blocks;
+
+      blocks = bfd_realloc (t->blocks, (nblocks + 1) * sizeof (*blocks));
+      if (blocks == NULL)
+	return NULL;
+      t->blocks = blocks;
+      blocks[nblocks] = bfd_malloc (EXECIT_POOL_BLOCK * sizeof (**blocks));
+      if (blocks[nblocks] == NULL)
+	return NULL;
+    }
+
+  he = andes_execit_hash_entry (t, t->count);
+  memset (he, 0, sizeof (*he));
+  he->key = *key;
+  he->hash = hash;
+  he->id = t->count;
+  t->slots[k] = ++t->count;
+
+  /* Keep the load factor under 1/2.  */
+  if (t->count * 2 > t->size && !andes_execit_hash_expand (t))
+    return NULL;
+
+  return he;
 }
 
-/* Initialize EXECIT hash table.  */
+/* Initialize EXECIT hash table of EXECIT.  */
 
 static int
-andes_execit_init (struct bfd_link_info *info)
+andes_execit_init (struct bfd_link_info *info, execit_state_t *execit)
 {
   /* init execit code hash  */
-  if (!bfd_hash_table_init_n (&execit.code_hash, riscv_elf_code_hash_newfunc,
-			      sizeof (execit_hash_t),
-			      1023))
+  if (!andes_execit_hash_init (&execit->code_hash, 1024))
     {
       (*_bfd_error_handler) (_("Linker: cannot init EXECIT hash table error \n"));
       return false;
@@ -5079,13 +5176,13 @@ andes_execit_init (struct bfd_link_info *info)
 		min_execinstr_addr = base;
 	    }
 	}
-	execit.jal_window_end = MASK_2M | min_execinstr_addr;
+	execit->jal_window_end = MASK_2M | min_execinstr_addr;
     }
 
   /* sanity check  */
-  BFD_ASSERT (execit.jal_window_end);
-  if (!execit.jal_window_end)
-    execit.jal_window_end = MASK_2M;
+  BFD_ASSERT (execit->jal_window_end);
+  if (!execit->jal_window_end)
+    execit->jal_window_end = MASK_2M;
 
   return true;
 }
@@ -5093,7 +5190,7 @@ andes_execit_init (struct bfd_link_info *info)
 /* Import .exec.itable and then build list.  */
 
 static void
-riscv_elf_execit_import_table (bfd *abfd ATTRIBUTE_UNUSED, struct bfd_link_info *info ATTRIBUTE_UNUSED)
+riscv_elf_execit_import_table (bfd *abfd, struct bfd_link_info *info)
 {
   int num = 0;
   bfd_byte buf[0x10];
@@ -5102,9 +5199,11 @@ riscv_elf_execit_import_table (bfd *abfd ATTRIBUTE_UNUSED, struct bfd_link_info
   FILE *execit_import_file;
   struct riscv_elf_link_hash_table *htab;
   andes_ld_options_t *andes;
+  execit_state_t *execit;
 
   htab = riscv_elf_hash_table (info);
   andes = &htab->andes;
+  execit = &htab->execit;
   execit_import_file = andes->execit_import_file;
   rewind (andes->execit_import_file);
 
@@ -5118,8 +5217,9 @@ riscv_elf_execit_import_table (bfd *abfd ATTRIBUTE_UNUSED, struct bfd_link_info
       execit_hash_t *he;
       size_t nread;
 
-      const char *hash = ctx.buf;
       memset (&ctx, 0, sizeof (ctx));
+      ctx.abfd = abfd;
+      ctx.info = info;
 
       nread = fread (contents, sizeof (bfd_byte) * 4, 1, execit_import_file);
       /* Ignore the final byte 0x0a.  */
@@ -5135,12 +5235,11 @@ riscv_elf_execit_import_table (bfd *abfd ATTRIBUTE_UNUSED, struct bfd_link_info
 	}
 
       /* add hash entry.  */
-      he = (execit_hash_t*)
-	bfd_hash_lookup (&execit.code_hash, hash, true, true);
+      he = andes_execit_hash_lookup (&execit->code_hash, &ctx.key, true);
       if (he == NULL)
 	{
 	  (*_bfd_error_handler)
-	    (_("Linker: failed import exec.it %s hash table\n"), hash);
+	    (_("Linker: failed import exec.it %#x hash table\n"), ctx.key.fixed);
 	  continue;
 	}
       else
@@ -5148,7 +5247,7 @@ riscv_elf_execit_import_table (bfd *abfd ATTRIBUTE_UNUSED, struct bfd_link_info
 	  he->is_imported = 1;
 	  he->is_chosen = 1;
 	  he->ie.entries = 1;
-	  he->ie.itable_index = execit.next_itable_index++;
+	  he->ie.itable_index = execit->next_itable_index++;
 	  /* to pass andes_execit_itable_lookup  */
 	  he->ie.fixed = ctx.ie.fixed;
 	}
@@ -5165,19 +5264,19 @@ riscv_elf_execit_import_table (bfd *abfd ATTRIBUTE_UNUSED, struct bfd_link_info
   /* Default set the maximun number of the EXECIT entries to 1024.
      There are still 1024 entries in .exec.itable even though the
      EXECIT limit setting exceeds the remaining entries.  */
-  execit.import_number = num;
+  execit->import_number = num;
   if (andes->update_execit_table
       && andes->execit_limit != -1
-      && (execit.import_number + andes->execit_limit) > EXECIT_HW_ENTRY_MAX)
+      && (execit->import_number + andes->execit_limit) > EXECIT_HW_ENTRY_MAX)
     (*_bfd_error_handler)
       (_("Warning: There are only %d entries of .exec.itable left for this time."),
-       (EXECIT_HW_ENTRY_MAX - execit.import_number));
+       (EXECIT_HW_ENTRY_MAX - execit->import_number));
 }
 
-/* Generate EXECIT hash from insn and its relocation.
- * key: "{code_pattern:x}|{rel_section:x}|{rel_offset:x}|{symbol:s}"
- *   code_pattern: opcode|registers
- *   rel_section:  vma of symbol
+/* Generate EXECIT hash key (execit_hash_key_t) from insn and its
+ * relocation.
+ *   fixed:        opcode|registers
+ *   rel_section:  owner of symbol
  *   rel_offset:   offset of symbol, or offset/(lui, auipc)
  *   symbol:       # SYM/global, LAB/local, ABS/constant
  * relocation is separated into section and offset instead of VMA
@@ -5190,23 +5289,24 @@ andes_execit_render_hash (execit_context_t *ctx)
   bfd *abfd = ctx->abfd;
   asection *sec = ctx->sec;
   const struct bfd_link_info *info = ctx->info;
+  execit_state_t *execit = &riscv_elf_hash_table (info)->execit;
   const Elf_Internal_Rela *irel = ctx->irel;
   const uint32_t insn = ctx->ie.insn;
   bfd_vma relocation_section = 0;
   bfd_vma relocation_offset = 0;
   int rtype = 0;
 
-  const char *symbol ="ABS";
+  uint32_t symbol = EXECIT_KEY_ABS;
   int rz = EXECIT_HASH_NG;
   BFD_ASSERT (ctx->ie.fixed || ctx->ie.relocation == 0);
-  ctx->buf[0] = 0;
+  memset (&ctx->key, 0, sizeof (ctx->key));
   ctx->ie.pc = off + (sec ? sec_addr(sec) : 0);
   ctx->ie.sec = sec;
 
   if (irel)
     {
       Elf_Internal_Shdr *symtab_hdr = &elf_tdata (abfd)->symtab_hdr;
-      andes_ld_options_t *andes = &execit.htab->andes;
+      andes_ld_options_t *andes = &execit->htab->andes;
       asection *sym_sec;
       bfd_vma symval;
       char symtype;
@@ -5235,7 +5335,7 @@ andes_execit_render_hash (execit_context_t *ctx)
 	  if (r_symndx < symtab_hdr->sh_info)
 	    { /* Local symbol.  */
 	      Elf_Internal_Sym *isym = NULL;
-	      symbol ="LAB";
+	      symbol = EXECIT_KEY_LAB;
 	      if (!riscv_get_local_syms (abfd, sec, &isym))
 		{
 		  BFD_ASSERT(0);
@@ -5266,7 +5366,7 @@ andes_execit_render_hash (execit_context_t *ctx)
 	      struct elf_link_hash_entry *h;
 	      struct elf_link_hash_entry **sym_hashes;
 	      unsigned long indx;
-	      symbol ="SYM";
+	      symbol = EXECIT_KEY_SYM;
 	      sym_hashes = elf_sym_hashes (abfd);
 	      indx = ELFNN_R_SYM (irel->r_info) - symtab_hdr->sh_info;
 	      h = sym_hashes[indx];
@@ -5304,7 +5404,7 @@ andes_execit_render_hash (execit_context_t *ctx)
 
 	      if (h->plt.offset != MINUS_ONE)
 		{
-		  sym_sec = execit.htab->elf.splt;
+		  sym_sec = execit->htab->elf.splt;
 		  symval = h->plt.offset;
 		}
 	      else if (h->root.u.def.section->output_section == NULL
@@ -5357,7 +5457,8 @@ andes_execit_render_hash (execit_context_t *ctx)
 
 	  /* special treaments for certain types of relocations.  */
 	  if (rtype == R_RISCV_JAL &&
-	      !execit_check_pchi_for_jal (ctx->ie.relocation, ctx->ie.pc))
+	      !execit_check_pchi_for_jal (execit, ctx->ie.relocation,
+					  ctx->ie.pc))
 	    return rz;
 	  else if (rtype == R_RISCV_HI20 || rtype == R_RISCV_CALL
 		   || rtype == R_RISCV_PCREL_HI20)
@@ -5393,11 +5494,12 @@ andes_execit_render_hash (execit_context_t *ctx)
     }
 
   if (rz == EXECIT_HASH_OK)
-    snprintf (ctx->buf, sizeof(ctx->buf), "%x|%llx|%llx|%s",
-	      ctx->ie.fixed,
-	      (long long unsigned int)relocation_section,
-	      (long long unsigned int)relocation_offset,
-	      symbol);
+    {
+      ctx->key.fixed = ctx->ie.fixed;
+      ctx->key.symbol = symbol;
+      ctx->key.rel_section = relocation_section;
+      ctx->key.rel_offset = relocation_offset;
+    }
   else
     BFD_ASSERT (irel);
 
@@ -5455,11 +5557,12 @@ riscv_get_local_syms (const bfd *abfd, asection *sec ATTRIBUTE_UNUSED,
    Return True if the jal can be replaced with exec.it safely.  */
 
 static bool
-execit_check_pchi_for_jal (bfd_vma relocation, bfd_vma insn_pc)
+execit_check_pchi_for_jal (const execit_state_t *execit, bfd_vma relocation,
+			   bfd_vma insn_pc)
 {
   bool result = true;
 
-  if (nsta.opt->execit_jal_over_2m)
+  if (execit->htab->andes.execit_jal_over_2m)
     {
       result = ((insn_pc >> 21) == (relocation >> 21));
     }
@@ -5469,8 +5572,8 @@ execit_check_pchi_for_jal (bfd_vma relocation, bfd_vma insn_pc)
        * which would fail the execit relaxation.
        * so far, only the first 2M window are accepted.
        */
-      if ((relocation > execit.jal_window_end) ||
-	  (insn_pc > execit.jal_window_end))
+      if ((relocation > execit->jal_window_end) ||
+	  (insn_pc > execit->jal_window_end))
 	result = false;
     }
 
@@ -5479,6 +5582,37 @@ execit_check_pchi_for_jal (bfd_vma relocation, bfd_vma insn_pc)
 
 /* } Andes  */
 
+/* The symbols defined in the section being relaxed, built once per relax
+   pass by the first deletion.  Both arrays are sorted by address, which
+   deleting bytes keeps, and the global symbols reached through more than
+   one name (--wrap, versioned symbols) appear once.  *_END_MAX[I] is an
+   upper bound of the end of the symbols up to I, to find the ones which
+   start before a deletion but span it.  */
+
+struct riscv_relax_sym_index
+{
+  asection *sec;
+  Elf_Internal_Sym **locals;
+  bfd_vma *local_end_max;
+  size_t local_count;
+  struct elf_link_hash_entry **globals;
+  bfd_vma *global_end_max;
+  size_t global_count;
+};
+typedef struct riscv_relax_sym_index riscv_relax_sym_index;
+
+static void
+riscv_free_relax_sym_index (riscv_relax_sym_index *x)
+{
+  if (x == NULL)
+    return;
+  free (x->locals);
+  free (x->local_end_max);
+  free (x->globals);
+  free (x->global_end_max);
+  free (x);
+}
+
 /* Initialize the pcgp reloc info in P.  */
 
 static bool
@@ -5486,6 +5620,12 @@ riscv_init_pcgp_relocs (riscv_pcgp_relocs *p)
 {
   p->hi = NULL;
   p->lo = NULL;
+  p->hi_index = NULL;
+  p->lo_index = NULL;
+  p->stale = false;
+  p->pending_delete = NULL;
+  p->sym_index = NULL;
+  p->prev_aligned_offset = 0;
   return true;
 }
 
@@ -5512,6 +5652,109 @@ riscv_free_pcgp_relocs (riscv_pcgp_relocs *p,
       free (l);
       l = next;
     }
+
+  if (p->hi_index != NULL)
+    htab_delete (p->hi_index);
+  if (p->lo_index != NULL)
+    htab_delete (p->lo_index);
+  riscv_free_relax_sym_index (p->sym_index);
+}
+
+/* The pcgp relocs are hashed by hi_sec_off, which comes first in both
+   the hi and the lo entries.  */
+
+static hashval_t
+riscv_pcgp_reloc_hash (const void *entry)
+{
+  const bfd_vma *off = entry;
+  return (hashval_t) (*off >> 1);
+}
+
+static int
+riscv_pcgp_reloc_eq (const void *entry1, const void *entry2)
+{
+  const bfd_vma *off1 = entry1, *off2 = entry2;
+  return *off1 == *off2;
+}
+
+/* Add the hi reloc C to the index of P.  The newest reloc at an offset is
+   the one found, as it was first on the list.  */
+
+static bool
+riscv_index_pcgp_hi_reloc (riscv_pcgp_relocs *p, riscv_pcgp_hi_reloc *c,
+			   bool newest)
+{
+  riscv_pcgp_hi_reloc **slot;
+
+  slot = (riscv_pcgp_hi_reloc **) htab_find_slot (p->hi_index, c, INSERT);
+  if (slot == NULL)
+    return false;
+  if (*slot == NULL)
+    {
+      c->same = NULL;
+      *slot = c;
+    }
+  else if (newest)
+    {
+      c->same = *slot;
+      *slot = c;
+    }
+  else
+    {
+      c->same = (*slot)->same;
+      (*slot)->same = c;
+    }
+  return true;
+}
+
+static bool
+riscv_index_pcgp_lo_reloc (riscv_pcgp_relocs *p, riscv_pcgp_lo_reloc *l)
+{
+  void **slot = htab_find_slot (p->lo_index, l, INSERT);
+  if (slot == NULL)
+    return false;
+  if (*slot == NULL)
+    *slot = l;
+  return true;
+}
+
+/* Create the indexes of P, or rebuild them after the offsets have been
+   moved by deleting bytes.  */
+
+static bool
+riscv_index_pcgp_relocs (riscv_pcgp_relocs *p)
+{
+  riscv_pcgp_hi_reloc *c;
+  riscv_pcgp_lo_reloc *l;
+
+  if (p->hi_index == NULL)
+    {
+      p->hi_index = htab_create (64, riscv_pcgp_reloc_hash,
+				 riscv_pcgp_reloc_eq, NULL);
+      p->lo_index = htab_create (64, riscv_pcgp_reloc_hash,
+				 riscv_pcgp_reloc_eq, NULL);
+      if (p->hi_index == NULL || p->lo_index == NULL)
+	return false;
+    }
+  else if (!p->stale)
+    return true;
+  else
+    {
+      htab_empty (p->hi_index);
+      htab_empty (p->lo_index);
+    }
+
+  /* The lists are newest first, so the first reloc seen at an offset
+     is the newest one.  */
+  for (c = p->hi; c != NULL; c = c->next)
+    if (!riscv_index_pcgp_hi_reloc (p, c, false))
+      return false;
+  for (l = p->lo; l != NULL; l = l->next)
+    if (!riscv_index_pcgp_lo_reloc (p, l))
+      return false;
+
+  p->stale = false;
+  return true;
 }
 
 /* Record pcgp hi part reloc info in P, using HI_SEC_OFF as the lookup index.
@@ -5524,7 +5767,11 @@ riscv_record_pcgp_hi_reloc (riscv_pcgp_relocs *p, bfd_vma hi_sec_off,
 			    unsigned hi_sym, asection *sym_sec,
 			    bool undefined_weak)
 {
-  riscv_pcgp_hi_reloc *new = bfd_zmalloc (sizeof (*new));
+  riscv_pcgp_hi_reloc *new;
+
+  if (!riscv_index_pcgp_relocs (p))
+    return false;
+  new = bfd_zmalloc (sizeof (*new));
   if (!new)
     return false;
   new->hi_sec_off = hi_sec_off;
@@ -5535,7 +5782,7 @@ riscv_record_pcgp_hi_reloc (riscv_pcgp_relocs *p, bfd_vma hi_sec_off,
   new->undefined_weak = undefined_weak;
   new->next = p->hi;
   p->hi = new;
-  return true;
+  return riscv_index_pcgp_hi_reloc (p, new, true);
 }
 
 static bool
@@ -5559,12 +5806,9 @@ riscv_record_pcgp_hi_reloc_ext (
 static riscv_pcgp_hi_reloc *
 riscv_find_pcgp_hi_reloc (riscv_pcgp_relocs *p, bfd_vma hi_sec_off)
 {
-  riscv_pcgp_hi_reloc *c;
-
-  for (c = p->hi; c != NULL; c = c->next)
-    if (c->hi_sec_off == hi_sec_off)
-      return c;
-  return NULL;
+  if (p->hi == NULL || !riscv_index_pcgp_relocs (p))
+    return NULL;
+  return htab_find (p->hi_index, &hi_sec_off);
 }
 
 /* Record pcgp lo part reloc info in P, using HI_SEC_OFF as the lookup info.
@@ -5573,26 +5817,23 @@ riscv_find_pcgp_hi_reloc (riscv_pcgp_relocs *p, bfd_vma hi_sec_off)
 static bool
 riscv_record_pcgp_lo_reloc (riscv_pcgp_relocs *p, bfd_vma hi_sec_off)
 {
-  riscv_pcgp_lo_reloc *new = bfd_malloc (sizeof (*new));
+  riscv_pcgp_lo_reloc *new;
+
+  if (!riscv_index_pcgp_relocs (p))
+    return false;
+  new = bfd_malloc (sizeof (*new));
   if (!new)
     return false;
   new->hi_sec_off = hi_sec_off;
   new->next = p->lo;
   p->lo = new;
-  return true;
+  return riscv_index_pcgp_lo_reloc (p, new);
 }
 
 static bool
 riscv_use_pcgp_hi_reloc(riscv_pcgp_relocs *p, bfd_vma hi_sec_off)
 {
-  bool out = false;
-  riscv_pcgp_hi_reloc *c;
-
-  for (c = p->hi; c != NULL; c = c->next)
-    if (c->hi_sec_off == hi_sec_off)
-      out = true;
-
-  return out;
+  return riscv_find_pcgp_hi_reloc (p, hi_sec_off) != NULL;
 }
 
 /* Look up lo part pcgp reloc info in P, using HI_SEC_OFF as the lookup index.
@@ -5601,107 +5842,379 @@ riscv_use_pcgp_hi_reloc(riscv_pcgp_relocs *p, bfd_vma hi_sec_off)
 static bool
 riscv_find_pcgp_lo_reloc (riscv_pcgp_relocs *p, bfd_vma hi_sec_off)
 {
-  riscv_pcgp_lo_reloc *c;
-
-  for (c = p->lo; c != NULL; c = c->next)
-    if (c->hi_sec_off == hi_sec_off)
-      return true;
-  return false;
+  if (p->lo == NULL || !riscv_index_pcgp_relocs (p))
+    return false;
+  return htab_find (p->lo_index, &hi_sec_off) != NULL;
 }
 
-static void
-riscv_update_pcgp_relocs (riscv_pcgp_relocs *p, asection *deleted_sec,
-			  bfd_vma deleted_addr, size_t deleted_count)
+/* Byte ranges deleted from one section while relaxing.  The ranges are
+   kept sorted by ADDR and do not overlap, and SHIFT is the total number
+   of bytes deleted by this range and all the ranges before it.  */
+
+typedef struct riscv_relax_delete_range
 {
-  /* Bytes have already been deleted and toaddr should match the old section
-     size for our checks, so adjust it here.  */
-  bfd_vma toaddr = deleted_sec->size + deleted_count;
-  riscv_pcgp_lo_reloc *l;
-  riscv_pcgp_hi_reloc *h;
+  bfd_vma addr;
+  bfd_vma count;
+  bfd_vma shift;
+} riscv_relax_delete_range;
 
-  /* Update section offsets of corresponding pcrel_hi relocs for the pcrel_lo
-     entries where they occur after the deleted bytes.  */
-  for (l = p->lo; l != NULL; l = l->next)
-    if (l->hi_sec_off > deleted_addr
-	&& l->hi_sec_off < toaddr)
-      l->hi_sec_off -= deleted_count;
+struct riscv_relax_delete_ranges
+{
+  asection *sec;
+  riscv_relax_delete_range *ranges;
+  size_t count;
+  size_t alloc;
+};
+typedef struct riscv_relax_delete_ranges riscv_relax_delete_ranges;
 
-  /* Update both section offsets, and symbol values of pcrel_hi relocs where
-     these values occur after the deleted bytes.  */
-  for (h = p->hi; h != NULL; h = h->next)
+/* Record COUNT bytes deleted at ADDR into the ranges D.  Nothing is moved
+   until riscv_relax_apply_delete_ranges is called.  */
+
+static bool
+riscv_record_delete_range (riscv_relax_delete_ranges *d, bfd_vma addr,
+			   bfd_vma count)
+{
+  size_t lo = 0, hi = d->count;
+
+  if (count == 0)
+    return true;
+
+  /* Relocs are relaxed in order, so this is usually an append.  */
+  if (d->count == 0 || d->ranges[d->count - 1].addr < addr)
+    lo = d->count;
+  else
+    while (lo < hi)
+      {
+	size_t mid = lo + (hi - lo) / 2;
+	if (d->ranges[mid].addr < addr)
+	  lo = mid + 1;
+	else
+	  hi = mid;
+      }
+
+  BFD_ASSERT (lo == 0
+	      || d->ranges[lo - 1].addr + d->ranges[lo - 1].count <= addr);
+  BFD_ASSERT (lo == d->count || addr + count <= d->ranges[lo].addr);
+
+  /* Adjacent ranges are not merged: a symbol at the start of a range
+     moves by the ranges before it only, so the boundary must be kept.  */
+  if (d->count == d->alloc)
     {
-      if (h->hi_sec_off > deleted_addr
-	  && h->hi_sec_off < toaddr)
-	h->hi_sec_off -= deleted_count;
-      if (h->sym_sec == deleted_sec
-	  && h->hi_addr > deleted_addr
-	  && h->hi_addr < toaddr)
-      h->hi_addr -= deleted_count;
+      size_t alloc = d->alloc ? d->alloc * 2 : 64;
+      riscv_relax_delete_range *ranges
+	= bfd_realloc (d->ranges, alloc * sizeof (*ranges));
+      if (ranges == NULL)
+	return false;
+      d->ranges = ranges;
+      d->alloc = alloc;
     }
+
+  memmove (d->ranges + lo + 1, d->ranges + lo,
+	   (d->count - lo) * sizeof (*d->ranges));
+  d->ranges[lo].addr = addr;
+  d->ranges[lo].count = count;
+  d->count++;
+  return true;
 }
 
-/* Delete some bytes from a section while relaxing.  */
+/* Return the number of bytes deleted by the ranges D before OFF, which
+   is the distance OFF moves down once the ranges are applied.  */
 
-static bool
-riscv_relax_delete_bytes (bfd *abfd,
-			  asection *sec,
-			  bfd_vma addr,
-			  size_t count,
-			  struct bfd_link_info *link_info,
-			  riscv_pcgp_relocs *p)
+static bfd_vma
+riscv_delete_shift (const riscv_relax_delete_ranges *d, bfd_vma off)
+{
+  size_t lo = 0, hi = d->count;
+
+  while (lo < hi)
+    {
+      size_t mid = lo + (hi - lo) / 2;
+      if (d->ranges[mid].addr < off)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  return lo == 0 ? 0 : d->ranges[lo - 1].shift;
+}
+
+/* Order the symbols by address, then by their place in the symbol table
+   or in memory, which keeps the order stable and the duplicates
+   adjacent.  */
+
+static int
+riscv_local_sym_cmp (const void *p1, const void *p2)
+{
+  const Elf_Internal_Sym *s1 = *(const Elf_Internal_Sym **) p1;
+  const Elf_Internal_Sym *s2 = *(const Elf_Internal_Sym **) p2;
+
+  if (s1->st_value != s2->st_value)
+    return s1->st_value < s2->st_value ? -1 : 1;
+  return s1 < s2 ? -1 : s1 > s2;
+}
+
+static int
+riscv_global_sym_cmp (const void *p1, const void *p2)
+{
+  const struct elf_link_hash_entry *h1
+    = *(const struct elf_link_hash_entry **) p1;
+  const struct elf_link_hash_entry *h2
+    = *(const struct elf_link_hash_entry **) p2;
+
+  if (h1->root.u.def.value != h2->root.u.def.value)
+    return h1->root.u.def.value < h2->root.u.def.value ? -1 : 1;
+  return h1 < h2 ? -1 : h1 > h2;
+}
+
+/* Build the index of the symbols defined in section SEC of ABFD.  Return
+   NULL if out of memory.  */
+
+static riscv_relax_sym_index *
+riscv_build_relax_sym_index (bfd *abfd, asection *sec)
 {
-  unsigned int i, symcount;
-  bfd_vma toaddr = sec->size;
   struct elf_link_hash_entry **sym_hashes = elf_sym_hashes (abfd);
   Elf_Internal_Shdr *symtab_hdr = &elf_tdata (abfd)->symtab_hdr;
   unsigned int sec_shndx = _bfd_elf_section_from_bfd_section (abfd, sec);
-  struct bfd_elf_section_data *data = elf_section_data (sec);
-  bfd_byte *contents = data->this_hdr.contents;
-
-  /* Actually delete the bytes.  */
-  sec->size -= count;
-  memmove (contents + addr, contents + addr + count, toaddr - addr - count);
+  unsigned int i, symcount;
+  riscv_relax_sym_index *x;
+  size_t n, k;
+  bfd_vma end_max;
 
-  /* Adjust the location of all of the relocs.  Note that we need not
-     adjust the addends, since all PC-relative references must be against
-     symbols, which we will adjust below.  */
-  for (i = 0; i < sec->reloc_count; i++)
-    if (data->relocs[i].r_offset > addr && data->relocs[i].r_offset < toaddr)
-      data->relocs[i].r_offset -= count;
+  symcount = ((symtab_hdr->sh_size / sizeof (ElfNN_External_Sym))
+	      - symtab_hdr->sh_info);
 
-  /* Adjust the hi_sec_off, and the hi_addr of any entries in the pcgp relocs
-     table for which these values occur after the deleted bytes.  */
-  if (p)
-    riscv_update_pcgp_relocs (p, sec, addr, count);
+  x = bfd_zmalloc (sizeof (*x));
+  if (x == NULL)
+    return NULL;
+  x->sec = sec;
+  x->locals = bfd_malloc (sizeof (*x->locals) * symtab_hdr->sh_info + 1);
+  x->local_end_max = bfd_malloc (sizeof (bfd_vma) * symtab_hdr->sh_info + 1);
+  x->globals = bfd_malloc (sizeof (*x->globals) * symcount + 1);
+  x->global_end_max = bfd_malloc (sizeof (bfd_vma) * symcount + 1);
+  if (x->locals == NULL || x->local_end_max == NULL
+      || x->globals == NULL || x->global_end_max == NULL)
+    {
+      riscv_free_relax_sym_index (x);
+      return NULL;
+    }
 
-  /* Adjust the local symbols defined in this section.  */
+  n = 0;
   for (i = 0; i < symtab_hdr->sh_info; i++)
     {
       Elf_Internal_Sym *sym = (Elf_Internal_Sym *) symtab_hdr->contents + i;
       if (sym->st_shndx == sec_shndx)
-	{
-	  /* If the symbol is in the range of memory we just moved, we
-	     have to adjust its value.  */
-	  if (sym->st_value > addr && sym->st_value <= toaddr)
-	    sym->st_value -= count;
-
-	  /* If the symbol *spans* the bytes we just deleted (i.e. its
-	     *end* is in the moved bytes but its *start* isn't), then we
-	     must adjust its size.
-
-	     This test needs to use the original value of st_value, otherwise
-	     we might accidentally decrease size when deleting bytes right
-	     before the symbol.  But since deleted relocs can't span across
-	     symbols, we can't have both a st_value and a st_size decrease,
-	     so it is simpler to just use an else.  */
-	  else if (sym->st_value <= addr
-		   && sym->st_value + sym->st_size > addr
-		   && sym->st_value + sym->st_size <= toaddr)
-	    sym->st_size -= count;
-	}
+	x->locals[n++] = sym;
+    }
+  qsort (x->locals, n, sizeof (*x->locals), riscv_local_sym_cmp);
+  x->local_count = n;
+  for (k = 0, end_max = 0; k < n; k++)
+    {
+      bfd_vma end = x->locals[k]->st_value + x->locals[k]->st_size;
+      end_max = end > end_max ? end : end_max;
+      x->local_end_max[k] = end_max;
     }
 
-  /* Now adjust the global symbols defined in this section.  */
+  n = 0;
+  for (i = 0; i < symcount; i++)
+    {
+      struct elf_link_hash_entry *sym_hash = sym_hashes[i];
+      if (sym_hash != NULL
+	  && (sym_hash->root.type == bfd_link_hash_defined
+	      || sym_hash->root.type == bfd_link_hash_defweak)
+	  && sym_hash->root.u.def.section == sec)
+	x->globals[n++] = sym_hash;
+    }
+  qsort (x->globals, n, sizeof (*x->globals), riscv_global_sym_cmp);
+
+  /* Drop the duplicates, so no symbol is adjusted twice.  */
+  for (i = 0, k = 0; i < n; i++)
+    if (k == 0 || x->globals[k - 1] != x->globals[i])
+      x->globals[k++] = x->globals[i];
+  x->global_count = k;
+  for (k = 0, end_max = 0; k < x->global_count; k++)
+    {
+      bfd_vma end = x->globals[k]->root.u.def.value + x->globals[k]->size;
+      end_max = end > end_max ? end : end_max;
+      x->global_end_max[k] = end_max;
+    }
+
+  return x;
+}
+
+/* Adjust the value and the size of a symbol from START to END for the
+   ranges D deleted below TOADDR.  */
+
+static void
+riscv_relax_adjust_sym (const riscv_relax_delete_ranges *d, bfd_vma toaddr,
+			bfd_vma *value, bfd_vma *size)
+{
+  bfd_vma start = *value;
+  bfd_vma end = *value + *size;
+
+  /* If the symbol is in the range of memory we just moved, we
+     have to adjust its value.  */
+  if (start <= toaddr)
+    *value -= riscv_delete_shift (d, start);
+
+  /* If the symbol *spans* the bytes we just deleted (i.e. its
+     *end* is in the moved bytes but its *start* isn't), then we
+     must adjust its size by the bytes deleted in between.  Since
+     deleted ranges can't span across symbols, the bytes deleted
+     before START are not part of that.  */
+  if (end <= toaddr)
+    *size -= (riscv_delete_shift (d, end)
+	      - riscv_delete_shift (d, start));
+}
+
+/* Adjust the symbols of the index X for the ranges D deleted below
+   TOADDR.  Only the symbols starting after the first deleted byte move,
+   and of the ones before only those ending after it change size.  */
+
+static void
+riscv_relax_adjust_indexed_syms (riscv_relax_sym_index *x,
+				 const riscv_relax_delete_ranges *d,
+				 bfd_vma toaddr)
+{
+  bfd_vma addr = d->ranges[0].addr;
+  size_t lo, hi, k;
+
+  lo = 0, hi = x->local_count;
+  while (lo < hi)
+    {
+      size_t mid = lo + (hi - lo) / 2;
+      if (x->locals[mid]->st_value <= addr)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  for (k = lo; k-- > 0 && x->local_end_max[k] > addr; )
+    riscv_relax_adjust_sym (d, toaddr, &x->locals[k]->st_value,
+			    &x->locals[k]->st_size);
+  for (k = lo; k < x->local_count; k++)
+    riscv_relax_adjust_sym (d, toaddr, &x->locals[k]->st_value,
+			    &x->locals[k]->st_size);
+
+  lo = 0, hi = x->global_count;
+  while (lo < hi)
+    {
+      size_t mid = lo + (hi - lo) / 2;
+      if (x->globals[mid]->root.u.def.value <= addr)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  for (k = lo; k-- > 0 && x->global_end_max[k] > addr; )
+    riscv_relax_adjust_sym (d, toaddr, &x->globals[k]->root.u.def.value,
+			    &x->globals[k]->size);
+  for (k = lo; k < x->global_count; k++)
+    riscv_relax_adjust_sym (d, toaddr, &x->globals[k]->root.u.def.value,
+			    &x->globals[k]->size);
+}
+
+/* Adjust the section offsets, and the symbol values of the pcgp relocs P
+   for the ranges D deleted from DELETED_SEC.  TOADDR is the section size
+   before the deletion.  The deferred deletions are applied once per pass,
+   so this is one walk per pass, and the indexes are only rebuilt when
+   next looked up.  */
+
+static void
+riscv_update_pcgp_relocs (riscv_pcgp_relocs *p, asection *deleted_sec,
+			  const riscv_relax_delete_ranges *d, bfd_vma toaddr)
+{
+  riscv_pcgp_lo_reloc *l;
+  riscv_pcgp_hi_reloc *h;
+
+  /* Update section offsets of corresponding pcrel_hi relocs for the pcrel_lo
+     entries where they occur after the deleted bytes.  */
+  for (l = p->lo; l != NULL; l = l->next)
+    if (l->hi_sec_off < toaddr)
+      l->hi_sec_off -= riscv_delete_shift (d, l->hi_sec_off);
+
+  /* Update both section offsets, and symbol values of pcrel_hi relocs where
+     these values occur after the deleted bytes.  */
+  for (h = p->hi; h != NULL; h = h->next)
+    {
+      if (h->hi_sec_off < toaddr)
+	h->hi_sec_off -= riscv_delete_shift (d, h->hi_sec_off);
+      if (h->sym_sec == deleted_sec
+	  && h->hi_addr < toaddr)
+	h->hi_addr -= riscv_delete_shift (d, h->hi_addr);
+    }
+
+  p->stale = true;
+}
+
+/* Delete all the byte ranges D from section SEC of ABFD in one sweep,
+   and adjust the relocs, symbols and pcgp relocs P accordingly.  */
+
+static bool
+riscv_relax_apply_delete_ranges (bfd *abfd,
+				 asection *sec,
+				 struct bfd_link_info *link_info,
+				 riscv_relax_delete_ranges *d,
+				 riscv_pcgp_relocs *p)
+{
+  unsigned int i, symcount;
+  size_t k;
+  bfd_vma shift, dst, toaddr = sec->size;
+  struct elf_link_hash_entry **sym_hashes = elf_sym_hashes (abfd);
+  Elf_Internal_Shdr *symtab_hdr = &elf_tdata (abfd)->symtab_hdr;
+  unsigned int sec_shndx = _bfd_elf_section_from_bfd_section (abfd, sec);
+  struct bfd_elf_section_data *data = elf_section_data (sec);
+  bfd_byte *contents = data->this_hdr.contents;
+
+  if (d->count == 0)
+    return true;
+
+  /* Actually delete the bytes, moving each kept chunk down only once.  */
+  shift = 0;
+  dst = d->ranges[0].addr;
+  for (k = 0; k < d->count; k++)
+    {
+      bfd_vma src = d->ranges[k].addr + d->ranges[k].count;
+      bfd_vma end = k + 1 < d->count ? d->ranges[k + 1].addr : toaddr;
+
+      BFD_ASSERT (src <= end);
+      memmove (contents + dst, contents + src, end - src);
+      dst += end - src;
+      shift += d->ranges[k].count;
+      d->ranges[k].shift = shift;
+    }
+  sec->size -= shift;
+
+  /* Adjust the location of all of the relocs.  Note that we need not
+     adjust the addends, since all PC-relative references must be against
+     symbols, which we will adjust below.  */
+  for (i = 0; i < sec->reloc_count; i++)
+    if (data->relocs[i].r_offset < toaddr)
+      data->relocs[i].r_offset -= riscv_delete_shift (d, data->relocs[i].r_offset);
+
+  /* Adjust the hi_sec_off, and the hi_addr of any entries in the pcgp relocs
+     table for which these values occur after the deleted bytes.  */
+  if (p)
+    riscv_update_pcgp_relocs (p, sec, d, toaddr);
+
+  /* Adjust the symbols defined in this section, through the index of the
+     section when it is being relaxed.  */
+  if (p != NULL && (p->sym_index == NULL || p->sym_index->sec != sec))
+    {
+      riscv_free_relax_sym_index (p->sym_index);
+      p->sym_index = riscv_build_relax_sym_index (abfd, sec);
+    }
+  if (p != NULL && p->sym_index != NULL)
+    {
+      riscv_relax_adjust_indexed_syms (p->sym_index, d, toaddr);
+      d->count = 0;
+      return true;
+    }
+
+  /* Adjust the local symbols defined in this section.  */
+  for (i = 0; i < symtab_hdr->sh_info; i++)
+    {
+      Elf_Internal_Sym *sym = (Elf_Internal_Sym *) symtab_hdr->contents + i;
+      if (sym->st_shndx == sec_shndx)
+	riscv_relax_adjust_sym (d, toaddr, &sym->st_value, &sym->st_size);
+    }
+
+  /* Now adjust the global symbols defined in this section.  */
   symcount = ((symtab_hdr->sh_size / sizeof (ElfNN_External_Sym))
 	      - symtab_hdr->sh_info);
 
@@ -5741,23 +6254,35 @@ riscv_relax_delete_bytes (bfd *abfd,
       if ((sym_hash->root.type == bfd_link_hash_defined
 	   || sym_hash->root.type == bfd_link_hash_defweak)
 	  && sym_hash->root.u.def.section == sec)
-	{
-	  /* As above, adjust the value if needed.  */
-	  if (sym_hash->root.u.def.value > addr
-	      && sym_hash->root.u.def.value <= toaddr)
-	    sym_hash->root.u.def.value -= count;
-
-	  /* As above, adjust the size if needed.  */
-	  else if (sym_hash->root.u.def.value <= addr
-		   && sym_hash->root.u.def.value + sym_hash->size > addr
-		   && sym_hash->root.u.def.value + sym_hash->size <= toaddr)
-	    sym_hash->size -= count;
-	}
+	riscv_relax_adjust_sym (d, toaddr, &sym_hash->root.u.def.value,
+				&sym_hash->size);
     }
 
+  d->count = 0;
   return true;
 }
 
+/* Delete some bytes from a section while relaxing.  If the deletions of
+   SEC are being deferred, just record them to be applied at the end of
+   the relax pass.  */
+
+static bool
+riscv_relax_delete_bytes (bfd *abfd,
+			  asection *sec,
+			  bfd_vma addr,
+			  size_t count,
+			  struct bfd_link_info *link_info,
+			  riscv_pcgp_relocs *p)
+{
+  riscv_relax_delete_range range = { addr, count, 0 };
+  riscv_relax_delete_ranges d = { sec, &range, 1, 1 };
+
+  if (p != NULL && p->pending_delete != NULL && p->pending_delete->sec == sec)
+    return riscv_record_delete_range (p->pending_delete, addr, count);
+
+  return riscv_relax_apply_delete_ranges (abfd, sec, link_info, &d, p);
+}
+
 typedef bool (*relax_func_t) (bfd *, asection *, asection *,
 			      struct bfd_link_info *,
 			      Elf_Internal_Rela *,
@@ -6019,7 +6544,9 @@ _bfd_riscv_relax_call (bfd *abfd, asection *sec, asection *sym_sec,
 	      || benefit == 0)
 	    return true;
 
-	  return riscv_update_table_jump_entry (tbljal_htab, symval, benefit, name);
+	  return riscv_update_table_jump_entry
+	    (riscv_elf_hash_table (link_info)->table_jump_htab, tbljal_htab,
+	     symval, benefit, name);
 	}
 
       /* Relax a table jump instruction that is marked. */
@@ -6256,7 +6783,7 @@ _bfd_riscv_relax_align (bfd *abfd, asection *sec,
 			bfd_vma max_alignment ATTRIBUTE_UNUSED,
 			bfd_vma reserve_size ATTRIBUTE_UNUSED,
 			bool *again ATTRIBUTE_UNUSED,
-			riscv_pcgp_relocs *pcgp_relocs ATTRIBUTE_UNUSED,
+			riscv_pcgp_relocs *pcgp_relocs,
 			bool undefined_weak ATTRIBUTE_UNUSED)
 {
   bfd_byte *contents = elf_section_data (sec)->this_hdr.contents;
@@ -6294,7 +6821,7 @@ _bfd_riscv_relax_align (bfd *abfd, asection *sec,
   if (nop_bytes & 3)
     {
       BFD_ASSERT ((nop_bytes & 3) == 2);
-      bfd_vma offset = nsta.prev_aligned_offset;
+      bfd_vma offset = pcgp_relocs->prev_aligned_offset;
       bfd_vma end = symval - sec_addr (sec);
       filled = andes_try_target_align (abfd, sec, sym_sec, link_info,
 				       rel, offset, end);
@@ -6302,7 +6829,7 @@ _bfd_riscv_relax_align (bfd *abfd, asection *sec,
       nop_bytes -= filled;
       rel->r_addend -= filled;
     }
-  nsta.prev_aligned_offset = rel->r_offset + nop_bytes;
+  pcgp_relocs->prev_aligned_offset = rel->r_offset + nop_bytes;
   /* } Andes */
 
   /* Delete the reloc.  */
@@ -6531,7 +7058,9 @@ _bfd_riscv_record_jal (bfd *abfd,
       || link_info->relax_pass > PASS_ZCE_TABLE_JUMP_COLLECT)
     return true;
 
-  return riscv_update_table_jump_entry (tbljal_htab, symval, 2, name); /* j => cm.jt */
+  return riscv_update_table_jump_entry
+    (riscv_elf_hash_table (link_info)->table_jump_htab, tbljal_htab,
+     symval, 2, name); /* j => cm.jt */
 }
 
 typedef struct
@@ -6542,67 +7071,63 @@ typedef struct
   unsigned int end;
 } riscv_table_jump_args;
 
-/* sort the table jump benefits in index range [arg->start, arg->end].  */
+/* Collect the table jump candidates into a flat array.  */
 
 static int
-riscv_ranking_table_jump (void **entry_ptr, void *_arg)
+riscv_collect_table_jump (void **entry_ptr, void *_arg)
 {
-  const riscv_table_jump_htab_entry *entry;
-  riscv_table_jump_args *arg;
-  riscv_table_jump_htab_t *htab;
-  unsigned int *savings;
-  const char **names;
-  bfd_vma *tbj_indexes;
+  riscv_table_jump_htab_entry ***p = (riscv_table_jump_htab_entry ***) _arg;
+  *(*p)++ = (riscv_table_jump_htab_entry *) *entry_ptr;
+  return true;
+}
 
-  entry = (const riscv_table_jump_htab_entry *) *entry_ptr;
-  arg = (riscv_table_jump_args*) _arg;
-  htab = (riscv_table_jump_htab_t *) arg->htab;
+/* Order by benefit, the larger first, then by the order of collection.  */
 
-  savings = htab->savings;
-  names = htab->names;
-  tbj_indexes = htab->tbj_indexes;
+static int
+riscv_table_jump_entry_cmp (const void *p1, const void *p2)
+{
+  const riscv_table_jump_htab_entry *e1
+    = *(const riscv_table_jump_htab_entry **) p1;
+  const riscv_table_jump_htab_entry *e2
+    = *(const riscv_table_jump_htab_entry **) p2;
 
-  /* search insert position and rank. */
-  unsigned int left = arg->start;
-  unsigned int right = arg->end + 1;
+  if (e1->benefit != e2->benefit)
+    return e1->benefit > e2->benefit ? -1 : 1;
+  return e1->id < e2->id ? -1 : e1->id > e2->id;
+}
 
-  while (left < right)
-    {
-      unsigned int mid = (left + right) / 2;
-      if (savings[mid] == entry->benefit)
-	{
-	  riscv_table_jump_htab_entry search = {.address = tbj_indexes[mid]};
-	  riscv_table_jump_htab_entry *e = htab_find (arg->tblj_htab, &search);
-	  if (entry->id > e->id)
-	    left = mid + 1;
-	  else
-	    {
-	      if (right == mid)
-		break;
-	      right = mid;
-	    }
-	}
-      else if (savings[mid] == 0
-	  || savings[mid] < entry->benefit)
-        right = mid;
-      else
-        left = mid + 1;
-    }
+/* sort the table jump benefits in index range [arg->start, arg->end].  */
 
-  for (unsigned int idx = arg->end; idx > left; idx--)
-    {
-      tbj_indexes[idx] = tbj_indexes[idx-1];
-      savings[idx] = savings[idx-1];
-      names[idx] = names[idx-1];
-    }
+static bool
+riscv_ranking_table_jump (riscv_table_jump_args *arg)
+{
+  riscv_table_jump_htab_t *htab = arg->htab;
+  riscv_table_jump_htab_entry **entries, **p;
+  size_t count = htab_elements (arg->tblj_htab);
+  size_t i, n;
+
+  if (count == 0)
+    return true;
+
+  entries = bfd_malloc (count * sizeof (*entries));
+  if (entries == NULL)
+    return false;
+
+  p = entries;
+  htab_traverse (arg->tblj_htab, riscv_collect_table_jump, &p);
+  qsort (entries, count, sizeof (*entries), riscv_table_jump_entry_cmp);
 
-  if (left <= arg->end)
+  n = arg->end - arg->start + 1;
+  if (n > count)
+    n = count;
+  for (i = 0; i < n; i++)
     {
-      tbj_indexes[left] = entry->address;
-      savings[left] = entry->benefit;
-      names[left] = entry->name;
+      htab->tbj_indexes[arg->start + i] = entries[i]->address;
+      htab->savings[arg->start + i] = entries[i]->benefit;
+      htab->names[arg->start + i] = entries[i]->name;
     }
 
+  free (entries);
   return true;
 }
 
@@ -6698,9 +7223,8 @@ riscv_table_jump_profiling (riscv_table_jump_htab_t *table_jump_htab,
   args->start = 0, args->end = 31; /* zc v1.0.0 rc5.7  */
   args->tblj_htab = table_jump_htab->tbljt_htab;
   /* Do a ranking. */
-  htab_traverse (table_jump_htab->tbljt_htab,
-	riscv_ranking_table_jump,
-	args);
+  if (!riscv_ranking_table_jump (args))
+    return false;
   riscv_record_table_jump_index (
 	  table_jump_htab->tbljt_htab,
 	  args);
@@ -6708,9 +7232,8 @@ riscv_table_jump_profiling (riscv_table_jump_htab_t *table_jump_htab,
 
   args->start = 32, args->end = 255;
   args->tblj_htab = table_jump_htab->tbljalt_htab;
-  htab_traverse (table_jump_htab->tbljalt_htab,
-	riscv_ranking_table_jump,
-	args);
+  if (!riscv_ranking_table_jump (args))
+    return false;
   riscv_record_table_jump_index (
 	  table_jump_htab->tbljalt_htab,
 	  args);
@@ -6762,6 +7285,59 @@ riscv_table_jump_profiling (riscv_table_jump_htab_t *table_jump_htab,
   return true;
 }
 
+/* Report the ranked table jump entries for --mtable-jump-stats: the
+   benefit of each one, the benefit accumulated up to it, and whether it
+   is kept after the profiling.  Like --print-gc-sections, the report
+   goes to the linker's info stream.  */
+
+static void
+riscv_print_table_jump_stats (struct bfd_link_info *info,
+			      riscv_table_jump_htab_t *table_jump_htab)
+{
+  unsigned int acc = 0, total = 0;
+  int i, used = 0;
+  char line[128];
+
+  info->callbacks->info (_("Table jump candidates: %lu cm.jt, %lu cm.jalt\n"),
+			 (unsigned long) htab_elements (table_jump_htab->tbljt_htab),
+			 (unsigned long) htab_elements (table_jump_htab->tbljalt_htab));
+  info->callbacks->info (_("  index  kind     address             benefit  accumulated  used  symbol\n"));
+  for (i = 0; i < 256; i++)
+    {
+      bool is_jt = i < 32;
+      bool is_used = (is_jt ? i < table_jump_htab->tbljt_count
+		      : i - 32 < table_jump_htab->tbljalt_count);
+
+      if (table_jump_htab->tbj_indexes[i] == 0)
+	{
+	  if (is_jt)
+	    {
+	      i = 31;
+	      continue;
+	    }
+	  break;
+	}
+
+      acc += table_jump_htab->savings[i];
+      if (is_used)
+	{
+	  total += table_jump_htab->savings[i];
+	  used++;
+	}
+      snprintf (line, sizeof (line),
+		"  %5d  %-7s  0x%016" PRIx64 "  %7u  %11u  %-4s  ", i,
+		is_jt ? "cm.jt" : "cm.jalt",
+		(uint64_t) table_jump_htab->tbj_indexes[i],
+		table_jump_htab->savings[i], acc,
+		is_used ? _("yes") : _("no"));
+      info->callbacks->info ("%s%s\n", line,
+			     table_jump_htab->names[i]
+			     ? table_jump_htab->names[i] : "");
+    }
+  info->callbacks->info (_("Table jump entries used: %d, saving %u bytes before %d bytes of table\n"),
+			 used, total, used * RISCV_ELF_WORD_BYTES);
+}
+
 /* Delete the bytes for R_RISCV_DELETE.  */
 
 static bool
@@ -6834,31 +7410,25 @@ _bfd_riscv_relax_section (bfd *abfd, asection *sec,
   unsigned int i;
   bfd_vma max_alignment, reserve_size = 0, used_bytes, trimmed_bytes;
   riscv_pcgp_relocs pcgp_relocs;
+  riscv_relax_delete_ranges pending_delete = { NULL, NULL, 0, 0 };
   riscv_table_jump_htab_t *table_jump_htab = htab->table_jump_htab;
   struct elf_link_hash_entry *jvt_sym;
 
   /* { Andes  */
   andes_ld_options_t *andes = &htab->andes;
+  execit_state_t *execit = &htab->execit;
   /* initialize stuff here  */
-  static int is_init = 0;
-  if (is_init == 0)
+  if (!htab->relax_init)
     { /* init states  */
-      if (nsta.opt == NULL)
-	{
-	  memset (&nsta, 0, sizeof (nsta));
-	  nsta.opt = andes;
-	}
-      memset (&ict, 0, sizeof (ict));
       /* init execit state here  */
-      memset (&execit, 0, sizeof (execit));
-      execit.htab = riscv_elf_hash_table (info);
+      execit->hi20_group_id = 1; /* 0 for non-grouped.  */
       /* exec.it or nexec.it  */
-      if (nsta.opt->execit_flags.nexecit_op != 0 ||
+      if (andes->execit_flags.nexecit_op != 0 ||
 	  riscv_has_subset (info, "xnexecit"))
-	execit.execit_op = NEXECIT_INSN;
+	execit->execit_op = NEXECIT_INSN;
       else
-	execit.execit_op = EXECIT_INSN;
-      is_init = 1;
+	execit->execit_op = EXECIT_INSN;
+      htab->relax_init = 1;
       /* init page size if not yet  */
       if (andes->set_relax_page_size == 0)
 	andes->set_relax_page_size = ELF_MAXPAGESIZE;
@@ -6894,9 +7464,6 @@ _bfd_riscv_relax_section (bfd *abfd, asection *sec,
 	  riscv_get_local_syms (owner, tjsec, &isym);
 	}
     }
-
-  /* Reset aligned offset each input section.  */
-  nsta.prev_aligned_offset = 0;
   /* } Andes  */
 
   *again = false;
@@ -6922,7 +7489,7 @@ _bfd_riscv_relax_section (bfd *abfd, asection *sec,
    *         relax_section might be invoked more than one time.
    *         but table jump must do only once.
    */
-  if ((!andes->set_table_jump || is_init > 1)
+  if ((!andes->set_table_jump || htab->relax_rounds > 0)
       && info->relax_pass >= PASS_ZCE_TABLE_JUMP_COLLECT
       && info->relax_pass <= PASS_ZCE_TABLE_JUMP_APPLY)
     return true;
@@ -6948,32 +7515,32 @@ _bfd_riscv_relax_section (bfd *abfd, asection *sec,
     }
 
   /* exec.it initializatoin if enabled.  */
-  if (!execit.is_init && info->relax_pass == PASS_EXECIT_1)
+  if (!execit->is_init && info->relax_pass == PASS_EXECIT_1)
     {
       bfd *output_bfd = info->output_bfd;
       if ((andes->target_optimization & RISCV_RELAX_EXECIT_ON) &&
 	  (output_bfd) &&
 	  (elf_elfheader (output_bfd)->e_flags & EF_RISCV_RVC))
 	{
-	  andes_execit_init (info);
+	  andes_execit_init (info, execit);
 	  /* For EXECIT update, we replace execit candiadtes to exec.it
 	     according to the imported table first. After that,
 	     we build the EXECIT hash table for the remaining patterns
 	     to do EXECIT replacement again.  */
 	  if (andes->execit_import_file)
 	    {
-	      if (!execit.is_update_itable)
-		execit.is_built = 1;
+	      if (!execit->is_update_itable)
+		execit->is_built = 1;
 	      riscv_elf_execit_import_table (abfd, info);
 	    }
 	}
       else
 	{
-	  execit.is_built = 1;
-	  execit.is_replaced = 1;
+	  execit->is_built = 1;
+	  execit->is_replaced = 1;
 	}
 
-      execit.is_init = 1;
+      execit->is_init = 1;
     }
   /* } Andes  */
 
@@ -6987,9 +7554,11 @@ _bfd_riscv_relax_section (bfd *abfd, asection *sec,
     goto fail;
 
   /* { Andes  */
-  /* Sort relocation by r_offset.  */
-  riscv_insertion_sort (relocs, sec->reloc_count,
-			sizeof (Elf_Internal_Rela), compar_reloc);
+  /* Sort relocation by r_offset.  Relaxation only ever shifts relocs
+     along with the code, so the cached relocs stay sorted and this is
+     a linear check after the first pass.  */
+  if (!_bfd_elf_sort_relocs_by_offset (relocs, sec->reloc_count))
+    goto fail;
 
   /*  exec.it processes:
    *    * pass 1 (now)
@@ -7002,11 +7571,11 @@ _bfd_riscv_relax_section (bfd *abfd, asection *sec,
   switch (info->relax_pass)
     {
     case PASS_ANDES_INIT:
-      if (execit.first_sec == NULL)
-	execit.first_sec = sec;
-      if (execit.is_built && execit.is_replaced)
+      if (execit->first_sec == NULL)
+	execit->first_sec = sec;
+      if (execit->is_built && execit->is_replaced)
 	return true;
-      execit.final_sec = sec;
+      execit->final_sec = sec;
       return true;
     /* Here is the entrance of EXECIT relaxation. There are two pass of
 	EXECIT relaxation. The one is to traverse all instructions and build
@@ -7014,41 +7583,46 @@ _bfd_riscv_relax_section (bfd *abfd, asection *sec,
 	it by exec.it.  */
     case PASS_EXECIT_1:
       if (andes->execit_import_file && andes->keep_import_execit
-	  && !andes->update_execit_table && sec == execit.final_sec)
+	  && !andes->update_execit_table && sec == execit->final_sec)
 	{ /* special case that itable needs to be built explicitly.  */
-	  andes_execit_traverse_insn_hash (andes_execit_rank_imported_insn);
+	  andes_execit_traverse_insn_hash (execit,
+					   andes_execit_rank_imported_insn);
 	  andes_execit_build_itable (info);
 	}
-      if (execit.is_built)
+      if (execit->is_built)
 	return true;
       if (!andes_execit_hash_insn (abfd, sec, info))
 	return false;
-      if (sec == execit.final_sec)
+      if (sec == execit->final_sec)
 	{ /* rank instruction patterns.  */
-	  andes_execit_traverse_insn_hash (andes_execit_rank_insn);
+	  andes_execit_traverse_insn_hash (execit, andes_execit_rank_insn);
 	  if (andes->execit_import_file)
-	    andes_execit_traverse_insn_hash (andes_execit_rank_imported_insn);
+	    andes_execit_traverse_insn_hash (execit,
+					     andes_execit_rank_imported_insn);
 	  andes_execit_build_itable (info);
-	  execit.is_built = 1;
+	  execit->is_built = 1;
+	  if (andes->execit_cache_file)
+	    andes_execit_save_cache (execit, andes->execit_cache_file,
+				     andes_execit_scan_options (andes));
 	}
       return true;
     case PASS_EXECIT_2:
-      if (execit.is_replaced)
+      if (execit->is_replaced)
 	return true;
       if (!andes_execit_replace_insn (info, abfd, sec))
 	return false;
-      if (sec == execit.final_sec)
+      if (sec == execit->final_sec)
 	{
-	  execit.is_replaced = 1;
+	  execit->is_replaced = 1;
 	  andes_execit_delete_blank (info);
-	  if (andes->update_execit_table && !execit.is_replace_again)
+	  if (andes->update_execit_table && !execit->is_replace_again)
 	    {
-	      execit.is_replace_again = 1;
-	      execit.is_update_itable = 1;
-	      execit.is_built = 0;
-	      execit.is_replaced = 0;
-	      execit.is_collect_done = 0;
-	      execit.is_collect_finish = 0;
+	      execit->is_replace_again = 1;
+	      execit->is_update_itable = 1;
+	      execit->is_built = 0;
+	      execit->is_replaced = 0;
+	      execit->is_collect_done = 0;
+	      execit->is_collect_finish = 0;
 	      info->relax_pass = PASS_EXECIT_1;
 	      info->relax_trip = -1;
 	      *again = true;
@@ -7056,18 +7630,18 @@ _bfd_riscv_relax_section (bfd *abfd, asection *sec,
 	}
       return true;
     case PASS_REDUCE: /* after PASS_RESLOVE */
-      if (!execit.is_itable_finalized)
+      if (!execit->is_itable_finalized)
 	{ /* finalize itable size  */
-	  execit.is_itable_finalized = 1;
+	  execit->is_itable_finalized = 1;
 	  if ((andes->execit_import_file == NULL) ||
 	      andes->keep_import_execit ||
 	      andes->update_execit_table)
 	    {
 	      asection *table_sec;
-	      table_sec = andes_execit_get_itable_section (info->input_bfds);
+	      table_sec = andes_execit_get_itable_section (info);
 	      BFD_ASSERT (table_sec != NULL);
 	      #ifdef ITABLE_IS_SAFE_TO_REDUCE
-	      table_sec->size = execit.next_itable_index << 2;
+	      table_sec->size = execit->next_itable_index << 2;
 	      #endif
 	    }
 	}
@@ -7078,7 +7652,7 @@ _bfd_riscv_relax_section (bfd *abfd, asection *sec,
     case PASS_ALIGN_ORG ... PASS_RESLOVE:
       break;
     case PASS_DELETE_ORG:
-      is_init += 1; /* track relax_section rounds.  */
+      htab->relax_rounds += 1; /* track relax_section rounds.  */
       break;
     default:
       (*_bfd_error_handler) (_("error: Unknow relax pass."));
@@ -7135,7 +7709,10 @@ _bfd_riscv_relax_section (bfd *abfd, asection *sec,
 
 	  riscv_table_jump_args args = {.htab = table_jump_htab};
 	  /* Estimate size savings if table jump is used.  */
-	  riscv_table_jump_profiling (table_jump_htab, &args);
+	  if (!riscv_table_jump_profiling (table_jump_htab, &args))
+	    return false;
+	  if (htab->andes.table_jump_stats)
+	    riscv_print_table_jump_stats (info, table_jump_htab);
 	  return true;
 	}
       /* Skip generating table jump instructions if they do not help reduce code size.   */
@@ -7206,6 +7783,18 @@ _bfd_riscv_relax_section (bfd *abfd, asection *sec,
 	}
     }
 
+  /* Defer the byte deletions of the passes which only shorten code, and
+     apply them all at once after the last reloc.  Relaxing with the stale
+     offsets is safe since deleting bytes never moves code further away;
+     alignment must see the real offsets, so it still deletes at once.  */
+  if (andes->set_relax_defer_delete
+      && (info->relax_pass == PASS_SHORTEN_ORG
+	  || info->relax_pass == PASS_DELETE_ORG))
+    {
+      pending_delete.sec = sec;
+      pcgp_relocs.pending_delete = &pending_delete;
+    }
+
   /* Examine and consider relaxing each reloc.  */
   for (i = 0; i < sec->reloc_count; i++)
     {
@@ -7258,7 +7847,7 @@ _bfd_riscv_relax_section (bfd *abfd, asection *sec,
 	}
       else if (info->relax_pass == PASS_ZCE_TABLE_JUMP_COLLECT)
 	{
-	  if (!nsta.use_table_jump)
+	  if (!htab->nsta.use_table_jump)
 	    return true;
 
 	  if (info->relax_trip == 0 || info->relax_trip == 2)
@@ -7289,7 +7878,7 @@ _bfd_riscv_relax_section (bfd *abfd, asection *sec,
 	}
       else if (info->relax_pass == PASS_ZCE_TABLE_JUMP_APPLY)
 	{
-	  if (!nsta.use_table_jump)
+	  if (!htab->nsta.use_table_jump)
 	    return true;
 
 	  if (andes->set_relax_call &&
@@ -7562,9 +8151,18 @@ _bfd_riscv_relax_section (bfd *abfd, asection *sec,
 	goto fail;
     }
 
+  if (pcgp_relocs.pending_delete != NULL)
+    {
+      pcgp_relocs.pending_delete = NULL;
+      if (!riscv_relax_apply_delete_ranges (abfd, sec, info, &pending_delete,
+					    &pcgp_relocs))
+	goto fail;
+    }
+
   ret = true;
 
  fail:
+  free (pending_delete.ranges);
   if (relocs != data->relocs)
     free (relocs);
   if (info->relax_pass == PASS_ANDES_GP_PCREL)
@@ -7576,10 +8174,10 @@ _bfd_riscv_relax_section (bfd *abfd, asection *sec,
   /* Free the unused info for relax_lui_gp_insn.  */
   struct relax_gp_sym_info *temp;
   if (info->relax_pass == 7)
-    while (relax_gp_sym_info_head != NULL)
+    while (htab->relax_gp_sym_info_head != NULL)
       {
-	temp = relax_gp_sym_info_head;
-	relax_gp_sym_info_head = relax_gp_sym_info_head->next;
+	temp = htab->relax_gp_sym_info_head;
+	htab->relax_gp_sym_info_head = temp->next;
 	free (temp);
       }
   /* } Andes */
@@ -7764,16 +8362,6 @@ riscv_elf_object_p (bfd *abfd)
   else
     bfd_default_set_arch_mach (abfd, bfd_arch_riscv, bfd_mach_riscv64);
 
-  /* { Andes */
-  /* Build the ict hash table to store all global symbols attached
-     with ICT suffix.  */
-  if (!ict.is_init)
-    {
-      riscv_elf_ict_init ();
-      ict.is_init = 1;
-    }
-  /* } Andes */
-
   return true;
 }
 
@@ -7799,7 +8387,7 @@ riscv_final_link (bfd * abfd, struct bfd_link_info * info)
   /* Andes: set exec.it table contents.  */
   while (true) /* once */
     {
-      asection *itable_sec = andes_execit_get_itable_section (info->input_bfds);
+      asection *itable_sec = andes_execit_get_itable_section (info);
       bfd_byte *contents = NULL;
       if (itable_sec == NULL)
 	break;
@@ -7971,13 +8559,14 @@ riscv_data_start_value (const struct bfd_link_info *info)
 }
 
 static relax_gp_sym_info_t*
-record_and_find_relax_gp_syms (asection *sec,
+record_and_find_relax_gp_syms (struct riscv_elf_link_hash_table *htab,
+			       asection *sec,
 			       Elf_Internal_Sym *lsym,
 			       struct elf_link_hash_entry *h,
 			       int record)
 {
   struct relax_gp_sym_info *ptr, *pre_ptr;
-  ptr = relax_gp_sym_info_head;
+  ptr = htab->relax_gp_sym_info_head;
   pre_ptr = ptr;
 
   /* Check whether the symbol is recorded.  */
@@ -7998,8 +8587,8 @@ record_and_find_relax_gp_syms (asection *sec,
       ptr->h = h;
       ptr->next = NULL;
 
-      if (!relax_gp_sym_info_head)
-	relax_gp_sym_info_head = ptr;
+      if (!htab->relax_gp_sym_info_head)
+	htab->relax_gp_sym_info_head = ptr;
       else
 	pre_ptr->next = ptr;
     }
@@ -8114,7 +8703,7 @@ _bfd_riscv_relax_lui_gp_insn (bfd *abfd, asection *sec, asection *sym_sec,
       hi.hi_sym = ELFNN_R_SYM (rel->r_info);
       hi.hi_addend = 0;
       if (ELFNN_R_TYPE (rel->r_info) == R_RISCV_HI20
-	  && !record_and_find_relax_gp_syms (sym_sec, isym, h, 0))
+	  && !record_and_find_relax_gp_syms (htab, sym_sec, isym, h, 0))
 	{
 	  /* The HI20 can be deleted safely.  */
 	  rel->r_info = ELFNN_R_INFO (0, R_RISCV_DELETE);
@@ -8122,15 +8711,15 @@ _bfd_riscv_relax_lui_gp_insn (bfd *abfd, asection *sec, asection *sym_sec,
 	  return true;
 	}
       else
-	do_replace = andes_relax_gp_insn (&insn, rel, &hi, sym_sec,
-					  symval, gp, data_start);
+	do_replace = andes_relax_gp_insn (&htab->nsta, &insn, rel, &hi,
+					  sym_sec, symval, gp, data_start);
 
       if (do_replace)
 	bfd_put_32 (abfd, insn, contents + rel->r_offset);
       else
 	/* The low insn can not be relaxed to v5 gp-relative insn.
 	   Record the referenced symbol.  */
-	record_and_find_relax_gp_syms (sym_sec, isym, h, 1);
+	record_and_find_relax_gp_syms (htab, sym_sec, isym, h, 1);
     }
 
   /* Do not relax lui to c.lui here since the dangerous delete
@@ -8138,55 +8727,340 @@ _bfd_riscv_relax_lui_gp_insn (bfd *abfd, asection *sec, asection *sym_sec,
   return true;
 }
 
-/* Generate EXECIT hash table.  */
+/* exec.it candidate scans.
+
+   Which instructions of an input section are exec.it candidates only
+   depends on the section contents, its relocations and the exec.it
+   options.  The scan of each section is kept by the hash of its contents
+   and relocations, so the replacement pass reuses the scan of the hashing
+   pass, and with --mexecit-cache a relink only scans again the sections
+   which have changed.  */
+
+typedef struct execit_scan_cand
+{
+  bfd_vma off;
+  unsigned int rel;	/* index + 1 of the reloc at OFF, 0 if none.  */
+} execit_scan_cand_t;
+
+typedef struct execit_scan
+{
+  uint64_t key;
+  bfd_size_type size;
+  unsigned int reloc_count;
+  unsigned int count;
+  execit_scan_cand_t *cands;
+  bool used;		/* used by this link, to be saved.  */
+} execit_scan_t;
+
+#define EXECIT_CACHE_MAGIC "RVEXITSC"
+#define EXECIT_CACHE_VERSION 1
+#define EXECIT_CACHE_HEADER_SIZE 20
+#define EXECIT_CACHE_ENTRY_SIZE 24
+#define EXECIT_CACHE_CAND_SIZE 12
+
+static hashval_t
+andes_execit_scan_hash (const void *p)
+{
+  const execit_scan_t *scan = p;
+  return (hashval_t) scan->key;
+}
+
+static int
+andes_execit_scan_eq (const void *p1, const void *p2)
+{
+  const execit_scan_t *s1 = p1, *s2 = p2;
+  return (s1->key == s2->key
+	  && s1->size == s2->size
+	  && s1->reloc_count == s2->reloc_count);
+}
+
+static void
+andes_execit_scan_free (void *p)
+{
+  execit_scan_t *scan = p;
+  free (scan->cands);
+  free (scan);
+}
+
+/* The exec.it options which decide the candidates, see
+   riscv_elf_execit_check_insn_available and riscv_relocation_check.  */
+
+static uint32_t
+andes_execit_scan_options (const andes_ld_options_t *andes)
+{
+  return (andes->execit_flags.rvv
+	  | andes->execit_flags.rvp << 1
+	  | andes->execit_flags.fls << 2
+	  | andes->execit_flags.xdsp << 3
+	  | andes->execit_loop_aware << 4);
+}
+
+/* Hash the CONTENTS and RELOCS of SEC into a 64-bit key.  */
+
+static uint64_t
+andes_execit_scan_key (asection *sec, const bfd_byte *contents,
+		       const Elf_Internal_Rela *relocs)
+{
+  hashval_t h1 = iterative_hash (contents, sec->size, 0);
+  hashval_t h2 = iterative_hash (contents, sec->size, 0x9e3779b9);
+  unsigned int i;
+
+  for (i = 0; i < sec->reloc_count; i++)
+    {
+      h1 = iterative_hash_object (relocs[i].r_offset, h1);
+      h1 = iterative_hash_object (relocs[i].r_info, h1);
+      h1 = iterative_hash_object (relocs[i].r_addend, h1);
+      h2 = iterative_hash_object (relocs[i].r_offset, h2);
+      h2 = iterative_hash_object (relocs[i].r_info, h2);
+      h2 = iterative_hash_object (relocs[i].r_addend, h2);
+    }
+
+  return (uint64_t) h1 << 32 | h2;
+}
+
+/* Load the scans saved to the cache file NAME by an earlier link.  A
+   missing file is not an error, and a stale or damaged one is ignored
+   from where it stops making sense.  */
+
+static void
+andes_execit_load_cache (execit_state_t *execit, const char *name,
+			 uint32_t options)
+{
+  bfd_byte buf[EXECIT_CACHE_ENTRY_SIZE];
+  unsigned int i, j, count;
+  long left;
+  FILE *file;
+
+  file = fopen (name, FOPEN_RB);
+  if (file == NULL)
+    return;
+
+  /* The candidate count of an entry is only trusted as far as the
+     file can hold that many candidates.  */
+  if (fseek (file, 0, SEEK_END) != 0
+      || (left = ftell (file)) < EXECIT_CACHE_HEADER_SIZE
+      || fseek (file, 0, SEEK_SET) != 0
+      || fread (buf, EXECIT_CACHE_HEADER_SIZE, 1, file) != 1
+      || memcmp (buf, EXECIT_CACHE_MAGIC, 8) != 0
+      || bfd_getl32 (buf + 8) != EXECIT_CACHE_VERSION
+      || bfd_getl32 (buf + 12) != options)
+    {
+      fclose (file);
+      return;
+    }
+
+  count = bfd_getl32 (buf + 16);
+  left -= EXECIT_CACHE_HEADER_SIZE;
+  for (i = 0; i < count; i++)
+    {
+      execit_scan_t *scan;
+      void **slot;
+
+      if (left < EXECIT_CACHE_ENTRY_SIZE
+	  || fread (buf, EXECIT_CACHE_ENTRY_SIZE, 1, file) != 1)
+	break;
+      left -= EXECIT_CACHE_ENTRY_SIZE;
+      if (bfd_getl32 (buf + 20)
+	  > (unsigned long) left / EXECIT_CACHE_CAND_SIZE)
+	break;
+      scan = bfd_zmalloc (sizeof (*scan));
+      if (scan == NULL)
+	break;
+      scan->key = bfd_getl64 (buf);
+      scan->size = bfd_getl64 (buf + 8);
+      scan->reloc_count = bfd_getl32 (buf + 16);
+      scan->count = bfd_getl32 (buf + 20);
+      left -= (long) scan->count * EXECIT_CACHE_CAND_SIZE;
+      scan->cands = bfd_malloc (scan->count * sizeof (*scan->cands) + 1);
+      if (scan->cands == NULL)
+	{
+	  free (scan);
+	  break;
+	}
+      for (j = 0; j < scan->count; j++)
+	{
+	  if (fread (buf, EXECIT_CACHE_CAND_SIZE, 1, file) != 1)
+	    break;
+	  scan->cands[j].off = bfd_getl64 (buf);
+	  scan->cands[j].rel = bfd_getl32 (buf + 8);
+	}
+      if (j != scan->count)
+	{
+	  andes_execit_scan_free (scan);
+	  break;
+	}
+      slot = htab_find_slot (execit->scan_cache, scan, INSERT);
+      if (slot == NULL || *slot != NULL)
+	{
+	  andes_execit_scan_free (scan);
+	  if (slot == NULL)
+	    break;
+	  continue;
+	}
+      *slot = scan;
+    }
+
+  fclose (file);
+}
+
+/* Write one scan used by this link to the cache file.  */
+
+static int
+andes_execit_save_scan (void **slot, void *data)
+{
+  execit_scan_t *scan = *slot;
+  FILE *file = data;
+  bfd_byte buf[EXECIT_CACHE_ENTRY_SIZE];
+  unsigned int i;
+
+  if (!scan->used)
+    return true;
+
+  bfd_putl64 (scan->key, buf);
+  bfd_putl64 (scan->size, buf + 8);
+  bfd_putl32 (scan->reloc_count, buf + 16);
+  bfd_putl32 (scan->count, buf + 20);
+  fwrite (buf, EXECIT_CACHE_ENTRY_SIZE, 1, file);
+  for (i = 0; i < scan->count; i++)
+    {
+      bfd_putl64 (scan->cands[i].off, buf);
+      bfd_putl32 (scan->cands[i].rel, buf + 8);
+      fwrite (buf, EXECIT_CACHE_CAND_SIZE, 1, file);
+    }
+  return true;
+}
+
+static int
+andes_execit_count_scan (void **slot, void *data)
+{
+  execit_scan_t *scan = *slot;
+  if (scan->used)
+    ++*(unsigned int *) data;
+  return true;
+}
+
+/* Save the scans used by this link to the cache file NAME.  The scans
+   of the inputs which are gone are dropped.  */
+
+static void
+andes_execit_save_cache (execit_state_t *execit, const char *name,
+			 uint32_t options)
+{
+  bfd_byte buf[EXECIT_CACHE_HEADER_SIZE];
+  unsigned int count = 0;
+  FILE *file;
+
+  if (execit->scan_cache == NULL)
+    return;
+
+  file = fopen (name, FOPEN_WB);
+  if (file == NULL)
+    {
+      (*_bfd_error_handler)
+	(_("warning: cannot write exec.it cache file %s"), name);
+      return;
+    }
+
+  htab_traverse (execit->scan_cache, andes_execit_count_scan, &count);
+  memcpy (buf, EXECIT_CACHE_MAGIC, 8);
+  bfd_putl32 (EXECIT_CACHE_VERSION, buf + 8);
+  bfd_putl32 (options, buf + 12);
+  bfd_putl32 (count, buf + 16);
+  fwrite (buf, EXECIT_CACHE_HEADER_SIZE, 1, file);
+  htab_traverse (execit->scan_cache, andes_execit_save_scan, file);
+
+  if (fclose (file) != 0)
+    (*_bfd_error_handler)
+      (_("warning: cannot write exec.it cache file %s"), name);
+}
+
+/* Check that the cached SCAN still fits SEC, since a key collision or
+   a damaged cache file must not turn data into exec.it candidates.  */
 
 static bool
-andes_execit_hash_insn (bfd *abfd, asection *sec,
-			struct bfd_link_info *link_info)
+andes_execit_scan_valid (const execit_scan_t *scan, asection *sec,
+			 const bfd_byte *contents,
+			 const Elf_Internal_Rela *relocs)
+{
+  unsigned int i;
+
+  for (i = 0; i < scan->count; i++)
+    {
+      const execit_scan_cand_t *cand = &scan->cands[i];
+      if (cand->off >= sec->size
+	  || sec->size - cand->off < 4
+	  || (cand->off & 1) != 0
+	  || (i > 0 && cand->off < scan->cands[i - 1].off + 4)
+	  || (contents[cand->off] & 0x3) != 0x3
+	  || cand->rel > sec->reloc_count
+	  || (cand->rel && relocs[cand->rel - 1].r_offset != cand->off))
+	return false;
+    }
+  return true;
+}
+
+/* Return the exec.it candidates of SEC, whose CONTENTS and RELOCS are
+   loaded, scanning from the reloc IREL on if the section is not known
+   yet.  Return NULL if out of memory.  */
+
+static execit_scan_t *
+andes_execit_scan_section (struct bfd_link_info *link_info, bfd *abfd,
+			   asection *sec, bfd_byte *contents,
+			   Elf_Internal_Rela *relocs, Elf_Internal_Rela *irel)
 {
-  static uint irel_id = 0;
-  bfd_byte *contents = NULL;
-  Elf_Internal_Sym *isym = NULL;
   struct riscv_elf_link_hash_table *htab = riscv_elf_hash_table (link_info);
+  execit_state_t *execit = &htab->execit;
+  andes_ld_options_t *andes = &htab->andes;
+  Elf_Internal_Rela *irelend = relocs + sec->reloc_count;
+  execit_scan_t search, *scan;
+  unsigned int alloc = 0;
   bfd_vma off = 0;
-  Elf_Internal_Rela *internal_relocs;
-  Elf_Internal_Rela *irelend;
-  Elf_Internal_Rela *irel;
-  execit_context_t ctx;
-  uint32_t insn;
   int data_flag;
-  int is_on_relocation;
-  int rtype;
-  const char *hash = ctx.buf;
-
-  ctx.abfd = abfd;
-  ctx.sec = sec;
-  ctx.info = link_info;
-
-  /* Load section instructions, relocations, and symbol table.  */
-  if (!riscv_get_section_contents (abfd, sec, &contents, true)
-      || !riscv_get_local_syms (abfd, sec, &isym))
-    return false;
+  void **slot;
 
-  internal_relocs = _bfd_elf_link_read_relocs (abfd, sec, NULL, NULL,
-					       true /* keep_memory  */);
-  irelend = internal_relocs + sec->reloc_count;
+  if (execit->scan_cache == NULL)
+    {
+      execit->scan_cache = htab_try_create (1024, andes_execit_scan_hash,
+					    andes_execit_scan_eq,
+					    andes_execit_scan_free);
+      if (execit->scan_cache == NULL)
+	return NULL;
+      if (andes->execit_cache_file)
+	andes_execit_load_cache (execit, andes->execit_cache_file,
+				 andes_execit_scan_options (andes));
+    }
 
-  /* Check the input section enable EXECIT?  */
-  irel = find_relocs_at_address (internal_relocs, internal_relocs, irelend,
-				 R_RISCV_RELAX_ENTRY);
+  memset (&search, 0, sizeof (search));
+  search.key = andes_execit_scan_key (sec, contents, relocs);
+  search.size = sec->size;
+  search.reloc_count = sec->reloc_count;
+  slot = htab_find_slot (execit->scan_cache, &search, INSERT);
+  if (slot == NULL)
+    return NULL;
+  scan = *slot;
+  if (scan != NULL)
+    {
+      if (andes_execit_scan_valid (scan, sec, contents, relocs))
+	{
+	  scan->used = true;
+	  return scan;
+	}
+      htab_clear_slot (execit->scan_cache, slot);
+      slot = htab_find_slot (execit->scan_cache, &search, INSERT);
+      if (slot == NULL)
+	return NULL;
+    }
 
-  /* Check this input section trigger EXECIT relaxation.  */
-  rtype = ELFNN_R_TYPE (irel->r_info);
-  if (irel == NULL || irel >= irelend || rtype != R_RISCV_RELAX_ENTRY
-      || (rtype == R_RISCV_RELAX_ENTRY
-	  && !(irel->r_addend & R_RISCV_RELAX_ENTRY_EXECIT_FLAG)))
-    return true;
+  scan = bfd_zmalloc (sizeof (*scan));
+  if (scan == NULL)
+    return NULL;
+  *scan = search;
+  scan->used = true;
 
-  /* hash insn. in andes_gen_execit_hash()  */
   while (off < sec->size)
     {
-      execit_hash_t *he;
+      execit_scan_cand_t *cand;
+      uint32_t insn;
 
       /* locate next nearby relocation  */
       while (irel != NULL && irel < irelend && irel->r_offset < off)
@@ -8220,30 +9094,104 @@ andes_execit_hash_insn (bfd *abfd, asection *sec,
 	  continue;
 	}
 
-      is_on_relocation =
-	(irel != NULL &&
-         irel < irelend &&
-	 irel->r_offset == off &&
-	 data_flag & SYMBOL_RELOCATION) ?
-	true : false;
+      if (scan->count == alloc)
+	{
+	  execit_scan_cand_t *cands;
+	  alloc = alloc ? alloc * 2 : 64;
+	  cands = bfd_realloc (scan->cands, alloc * sizeof (*cands));
+	  if (cands == NULL)
+	    {
+	      andes_execit_scan_free (scan);
+	      htab_clear_slot (execit->scan_cache, slot);
+	      return NULL;
+	    }
+	  scan->cands = cands;
+	}
+
+      cand = &scan->cands[scan->count++];
+      cand->off = off;
+      cand->rel = (irel != NULL
+		   && irel < irelend
+		   && irel->r_offset == off
+		   && (data_flag & SYMBOL_RELOCATION)) ? irel - relocs + 1 : 0;
+      off += 4;
+    }
+
+  *slot = scan;
+  return scan;
+}
+
+/* Generate EXECIT hash table.  */
+
+static bool
+andes_execit_hash_insn (bfd *abfd, asection *sec,
+			struct bfd_link_info *link_info)
+{
+  bfd_byte *contents = NULL;
+  Elf_Internal_Sym *isym = NULL;
+  struct riscv_elf_link_hash_table *htab = riscv_elf_hash_table (link_info);
+  execit_state_t *execit = &htab->execit;
+  bfd_vma off = 0;
+  Elf_Internal_Rela *internal_relocs;
+  Elf_Internal_Rela *irelend;
+  Elf_Internal_Rela *irel;
+  execit_context_t ctx;
+  execit_scan_t *scan;
+  unsigned int i;
+  uint32_t insn;
+  int rtype;
+
+  ctx.abfd = abfd;
+  ctx.sec = sec;
+  ctx.info = link_info;
+
+  /* Load section instructions, relocations, and symbol table.  */
+  if (!riscv_get_section_contents (abfd, sec, &contents, true)
+      || !riscv_get_local_syms (abfd, sec, &isym))
+    return false;
+
+  internal_relocs = _bfd_elf_link_read_relocs (abfd, sec, NULL, NULL,
+					       true /* keep_memory  */);
+  irelend = internal_relocs + sec->reloc_count;
+
+  /* Check the input section enable EXECIT?  */
+  irel = find_relocs_at_address (internal_relocs, internal_relocs, irelend,
+				 R_RISCV_RELAX_ENTRY);
+
+  /* Check this input section trigger EXECIT relaxation.  */
+  rtype = ELFNN_R_TYPE (irel->r_info);
+  if (irel == NULL || irel >= irelend || rtype != R_RISCV_RELAX_ENTRY
+      || (rtype == R_RISCV_RELAX_ENTRY
+	  && !(irel->r_addend & R_RISCV_RELAX_ENTRY_EXECIT_FLAG)))
+    return true;
+
+  scan = andes_execit_scan_section (link_info, abfd, sec, contents,
+				    internal_relocs, irel);
+  if (scan == NULL)
+    return false;
 
+  /* hash insn. in andes_gen_execit_hash()  */
+  for (i = 0; i < scan->count; i++)
+    {
+      execit_hash_t *he;
+      unsigned int rel = scan->cands[i].rel;
+
+      off = scan->cands[i].off;
+      insn = bfd_get_32 (abfd, contents + off);
       memset (&ctx.ie, 0, sizeof (ctx.ie));
       ctx.ie.insn = insn;
-      ctx.irel = is_on_relocation ? irel : NULL;
+      ctx.irel = rel ? internal_relocs + rel - 1 : NULL;
       ctx.off = off;
       if (andes_execit_render_hash (&ctx) != EXECIT_HASH_OK)
-	{
-	  off += 4;
-	  continue;
-	}
+	continue;
 
       /* add hash entry.  */
-      he = (execit_hash_t*)
-	bfd_hash_lookup (&execit.code_hash, hash, true, true);
+      he = andes_execit_hash_lookup (&execit->code_hash, &ctx.key, true);
       if (he == NULL)
 	{
 	  (*_bfd_error_handler)
-	    (_("Linker: failed creating exec.it %s hash table\n"), hash);
+	    (_("Linker: failed creating exec.it %#x hash table\n"),
+	     ctx.key.fixed);
 	  return false;
 	}
 
@@ -8256,7 +9204,7 @@ andes_execit_hash_insn (bfd *abfd, asection *sec,
 	      || rtype == R_RISCV_PCREL_HI20))
 	{
 	  execit_irel_t *e = bfd_zmalloc (sizeof (execit_irel_t));
-	  e->id = ++irel_id;
+	  e->id = ++execit->irel_id;
 	  e->ie = ctx.ie;
 	  LIST_APPEND (&he->irels, e);
 	}
@@ -8265,7 +9213,6 @@ andes_execit_hash_insn (bfd *abfd, asection *sec,
 	he->ie = ctx.ie;
 
       he->ie.est_count++;
-      off += 4;
     }
   return true;
 }
@@ -8273,21 +9220,16 @@ andes_execit_hash_insn (bfd *abfd, asection *sec,
 /* Hash table traverse function.  */
 
 static void
-andes_execit_traverse_insn_hash (int (*func) (execit_hash_t*))
+andes_execit_traverse_insn_hash (execit_state_t *execit,
+				 int (*func) (execit_state_t *,
+					      execit_hash_t *))
 {
   unsigned int i;
 
-  execit.code_hash.frozen = 1;
-  for (i = 0; i < execit.code_hash.size; i++)
-    {
-      struct bfd_hash_entry *p;
-
-      for (p = execit.code_hash.table[i]; p != NULL; p = p->next)
-	if (!func ((execit_hash_t *) p))
-	  goto out;
-    }
-out:
-  execit.code_hash.frozen = 0;
+  /* Visit the entries in their creation order.  */
+  for (i = 0; i < execit->code_hash.count; i++)
+    if (!func (execit, andes_execit_hash_entry (&execit->code_hash, i)))
+      break;
 }
 
 /* Examine each insn times in hash table.
@@ -8299,7 +9241,7 @@ out:
 #define EXECIT_GRADE(c,e) (int) (200.0 * (c - 2) / e)
 
 static int
-andes_execit_rank_insn (execit_hash_t *he)
+andes_execit_rank_insn (execit_state_t *execit, execit_hash_t *he)
 {
   execit_itable_t *ie = &he->ie;
   Elf_Internal_Rela *irel = ie->irel;
@@ -8308,7 +9250,7 @@ andes_execit_rank_insn (execit_hash_t *he)
   if ((rtype == R_RISCV_HI20)
       || (rtype == R_RISCV_CALL || rtype == R_RISCV_PCREL_HI20))
     { /* HI20: LUI or AUIPC */
-      andes_execit_estimate_hi20 (he);
+      andes_execit_estimate_hi20 (execit, he);
       execit_irel_t *p = he->irels;
       int i, j;
       while (p)
@@ -8321,7 +9263,7 @@ andes_execit_rank_insn (execit_hash_t *he)
 	      re->data = (void*) p; /* group representative.  */
 	      re->he = he;
 	      he->is_worthy = true;
-	      LIST_ITER (&execit.rank_list, re, rank_each_cb, append_final_cb);
+	      LIST_ITER (&execit->rank_list, re, rank_each_cb, append_final_cb);
 	      /* skip the same ID.  */
 	      for (i = 1, j = p->ie.est_count; i < j; ++i)
 		p = p->next;
@@ -8339,7 +9281,7 @@ andes_execit_rank_insn (execit_hash_t *he)
   re->grade =  EXECIT_GRADE (ie->est_count, ie->entries);
   re->he = he;
   he->is_worthy = true;
-  LIST_ITER (&execit.rank_list, re, rank_each_cb, append_final_cb);
+  LIST_ITER (&execit->rank_list, re, rank_each_cb, append_final_cb);
 
   return true;
 }
@@ -8349,7 +9291,7 @@ andes_execit_rank_insn (execit_hash_t *he)
 */
 
 static int
-andes_execit_rank_imported_insn (execit_hash_t *he)
+andes_execit_rank_imported_insn (execit_state_t *execit, execit_hash_t *he)
 {
   execit_rank_t *re, *p, *pp;
 
@@ -8362,7 +9304,7 @@ andes_execit_rank_imported_insn (execit_hash_t *he)
 
   /* insert imported exec.it entries  */
   pp = NULL;
-  p = execit.rank_list;
+  p = execit->rank_list;
   while (p)
     {
       if ((! p->he->is_imported) ||
@@ -8376,7 +9318,7 @@ andes_execit_rank_imported_insn (execit_hash_t *he)
   if (pp)
     pp->next = re;
   else
-    execit.rank_list = re;
+    execit->rank_list = re;
 
   return true;
 }
@@ -8384,7 +9326,8 @@ andes_execit_rank_imported_insn (execit_hash_t *he)
 /* free each insn hash entry deeply.  */
 
 static int
-andes_execit_free (execit_hash_t *he)
+andes_execit_free (execit_state_t *execit ATTRIBUTE_UNUSED,
+		   execit_hash_t *he)
 {
   if (he->irels)
     {
@@ -8407,6 +9350,7 @@ andes_execit_free (execit_hash_t *he)
 static void
 andes_execit_build_itable (struct bfd_link_info *info)
 {
+  execit_state_t *execit = &riscv_elf_hash_table (info)->execit;
   bfd *abfd;
   asection *table_sec;
   execit_rank_t *p;
@@ -8423,7 +9367,7 @@ andes_execit_build_itable (struct bfd_link_info *info)
   while (true)
     {
       /* Find the section .exec.itable, and put all entries into it.  */
-      table_sec = andes_execit_get_itable_section (info->input_bfds);
+      table_sec = andes_execit_get_itable_section (info);
       if (table_sec == NULL)
 	break;
 
@@ -8435,7 +9379,7 @@ andes_execit_build_itable (struct bfd_link_info *info)
 	break;
 
       /* skip ITB checking if there is no candidate. bug#23317  */
-      if (execit.rank_list == NULL)
+      if (execit->rank_list == NULL)
 	break;
 
       /* Check ITB register if set.  */
@@ -8471,7 +9415,7 @@ andes_execit_build_itable (struct bfd_link_info *info)
 
   /* TODO: change the e_flag for EXECIT.  */
 
-  if (execit.is_rebuilding)
+  if (execit->is_rebuilding)
     limit = table_sec->size >> 2;
   else
     limit = andes->execit_limit;
@@ -8480,8 +9424,8 @@ andes_execit_build_itable (struct bfd_link_info *info)
   if (andes->execit_import_file
       && andes->update_execit_table
       && andes->execit_limit >= 0
-      && execit.is_rebuilding == 0)
-    limit += execit.next_itable_index;
+      && execit->is_rebuilding == 0)
+    limit += execit->next_itable_index;
   if ((limit < 0) || (limit > EXECIT_HW_ENTRY_MAX))
     limit = EXECIT_HW_ENTRY_MAX;
 
@@ -8491,7 +9435,7 @@ andes_execit_build_itable (struct bfd_link_info *info)
 
   /* might have imported some  */
   total = count = order = index = 0;
-  for (p = execit.rank_list;
+  for (p = execit->rank_list;
        p && index < limit;
        p = p->next)
     {
@@ -8545,15 +9489,15 @@ andes_execit_build_itable (struct bfd_link_info *info)
 #endif
     }
 
-  if (execit.is_rebuilding == 0)
+  if (execit->is_rebuilding == 0)
     table_sec->size = total << 2;
   else
     BFD_ASSERT (table_sec->size >= ((bfd_size_type)total << 2));
 
   /* build itable[0..size] = [item, ...]  */
-  execit.itable_array = bfd_zmalloc (sizeof (execit_item_t) * total);
+  execit->itable_array = bfd_zmalloc (sizeof (execit_item_t) * total);
   index = 0;
-  for (p = execit.rank_list;
+  for (p = execit->rank_list;
        p && index < limit;
        p = p->next)
     {
@@ -8561,15 +9505,15 @@ andes_execit_build_itable (struct bfd_link_info *info)
       if (!p->is_chosen)
 	continue;
 
-      execit_item_t *item = &execit.itable_array[index];
+      execit_item_t *item = &execit->itable_array[index];
       item->he = he;
       if (p->data) /* group representative.  */
 	item->grp_hd = p->data;
       index++;
     }
 
-  execit.raw_itable_entries = index;
-  execit.next_itable_index = index;
+  execit->raw_itable_entries = index;
+  execit->next_itable_index = index;
 }
 
 /* Replace input file instruction which is in the .exec.itable.  */
@@ -8581,13 +9525,14 @@ andes_execit_replace_insn (struct bfd_link_info *link_info,
   bfd_byte *contents = NULL;
   Elf_Internal_Sym *isym = NULL;
   struct riscv_elf_link_hash_table *htab = riscv_elf_hash_table (link_info);
+  execit_state_t *execit = &htab->execit;
   bfd_vma off = 0;
   Elf_Internal_Rela *internal_relocs;
   Elf_Internal_Rela *irelend;
   Elf_Internal_Rela *irel;
+  execit_scan_t *scan;
+  unsigned int i;
   uint32_t insn;
-  int data_flag;
-  int is_on_relocation;
   execit_context_t ctx;
   bool is_replace;
   
@@ -8617,64 +9562,28 @@ andes_execit_replace_insn (struct bfd_link_info *link_info,
 	  && !(irel->r_addend & R_RISCV_RELAX_ENTRY_EXECIT_FLAG)))
     return true;
 
+  scan = andes_execit_scan_section (link_info, abfd, sec, contents,
+				    internal_relocs, irel);
+  if (scan == NULL)
+    return false;
+
   /* hash insn. in andes_gen_execit_hash()  */
-  char *hash = ctx.buf;
-  while (off < sec->size)
+  for (i = 0; i < scan->count; i++)
     {
       execit_hash_t* entry;
+      unsigned int rel = scan->cands[i].rel;
 
-      /* locate next nearby relocation  */
-      while (irel != NULL && irel < irelend && irel->r_offset < off)
-	irel++;
-
-      data_flag = riscv_relocation_check (link_info, &irel, irelend, sec,
-					  &off, contents, 1);
-
-      if (data_flag & DATA_EXIST)
-	{
-	  off += (data_flag >> 24);
-	  continue;
-	}
-      else if (data_flag & RELAX_REGION_END)
-	{
-	  continue;
-	}
-
-      /* skip 16-bit instruction.  */
-      if ((*(contents + off) & 0x3) != 0x3)
-	{
-	  off += 2;
-	  continue;
-	}
-
-      /* filter out some sorts of pattern unsafe or hard to exec.it  */
+      off = scan->cands[i].off;
       insn = bfd_get_32 (abfd, contents + off);
-      if (!riscv_elf_execit_check_insn_available (insn, htab))
-	{
-	  off += 4;
-	  continue;
-	}
-
-      is_on_relocation =
-	(irel != NULL &&
-         irel < irelend &&
-	 irel->r_offset == off &&
-	 data_flag & SYMBOL_RELOCATION) ?
-	true : false;
-
-      ctx.irel = is_on_relocation ? irel : NULL;
+      ctx.irel = rel ? internal_relocs + rel - 1 : NULL;
       ctx.off = off;
       memset (&ctx.ie, 0, sizeof (ctx.ie));
       ctx.ie.insn = insn;
       if (andes_execit_render_hash (&ctx) != EXECIT_HASH_OK)
-	{
-	  off += 4;
-	  continue;
-	}
+	continue;
 
       /* lookup hash table.  */
-      entry = (execit_hash_t*)
-	bfd_hash_lookup (&execit.code_hash, hash, false, false);
+      entry = andes_execit_hash_lookup (&execit->code_hash, &ctx.key, false);
 
       /* HI20 type might be choosen partially for exec.it.  */
       is_replace = entry && entry->is_chosen;
@@ -8683,7 +9592,7 @@ andes_execit_replace_insn (struct bfd_link_info *link_info,
 	  execit_irel_t *p = entry->irels;
 	  while (p)
 	    {
-	      if (p->ie.irel == irel)
+	      if (p->ie.irel == ctx.irel)
 		break;
 	      p = p->next;
 	    }
@@ -8691,18 +9600,13 @@ andes_execit_replace_insn (struct bfd_link_info *link_info,
 	    is_replace = p->is_chosen;
 	}
       if (!is_replace)
-	{
-	  off += 4;
-	  continue;
-	}
+	continue;
 
       /* replace insn now.  */
       ctx.contents = contents;
       if (!andes_execit_push_insn (&ctx, entry))
 	BFD_ASSERT (0);
-
-      off += 4;
-    } /* while off  */
+    }
 
   return true;
 }
@@ -8712,7 +9616,8 @@ andes_execit_replace_insn (struct bfd_link_info *link_info,
 static void
 andes_execit_delete_blank (struct bfd_link_info *info)
 {
-  execit_blank_abfd_t *pabfd = execit.blank_list;
+  execit_state_t *execit = &riscv_elf_hash_table (info)->execit;
+  execit_blank_abfd_t *pabfd = execit->blank_list;
   execit_blank_abfd_t *qabfd = NULL;
 
   while (pabfd)
@@ -8746,28 +9651,29 @@ andes_execit_delete_blank (struct bfd_link_info *info)
 	}
 	free (qabfd);
     }
-  execit.blank_list = NULL;
+  execit->blank_list = NULL;
 }
 
 /* Get section .exec.itable.  */
 
 static asection*
-andes_execit_get_itable_section (bfd *input_bfds)
+andes_execit_get_itable_section (struct bfd_link_info *info)
 {
+  execit_state_t *execit = &riscv_elf_hash_table (info)->execit;
   asection *sec = NULL;
   bfd *abfd;
 
-  if (execit.itable_section != NULL)
-    return execit.itable_section;
+  if (execit->itable_section != NULL)
+    return execit->itable_section;
 
-  for (abfd = input_bfds; abfd != NULL; abfd = abfd->link.next)
+  for (abfd = info->input_bfds; abfd != NULL; abfd = abfd->link.next)
     {
       sec = bfd_get_section_by_name (abfd, EXECIT_SECTION);
       if (sec != NULL)
 	break;
     }
 
-  execit.itable_section = sec;
+  execit->itable_section = sec;
   return sec;
 }
 
@@ -8776,45 +9682,46 @@ andes_execit_deal_phase (struct bfd_link_info *info, asection *sec,
 			 bool *again)
 {
   struct riscv_elf_link_hash_table *htab = riscv_elf_hash_table (info);
+  execit_state_t *execit = &htab->execit;
 
   if (*(htab->data_segment_phase) == 0)
     {
-      if (sec == execit.first_sec)
+      if (sec == execit->first_sec)
 	{
-	  execit.prev_gp = execit.curr_gp;
-	  execit.curr_gp = riscv_global_pointer_value (info);
+	  execit->prev_gp = execit->curr_gp;
+	  execit->curr_gp = riscv_global_pointer_value (info);
 	  if (info->relax_trip > 0)
 	    {
-	      execit.is_collect_again = (execit.curr_gp != execit.prev_gp) ?
+	      execit->is_collect_again = (execit->curr_gp != execit->prev_gp) ?
 		1 : 0;
 	    }
 
-	  if (execit.is_collect_again == 1)
+	  if (execit->is_collect_again == 1)
 	    {
-	      execit.is_rebuilding = 1;
-	      andes_execit_reset (again);
+	      execit->is_rebuilding = 1;
+	      andes_execit_reset (execit, again);
 	    }
 
-	  if (execit.is_collect_done == 1)
+	  if (execit->is_collect_done == 1)
 	    {
-	      if (execit.is_collect_finish == 1)
+	      if (execit->is_collect_finish == 1)
 		{
 		  *again = false;
 		}
 	      else
 		{
 		  *again = true;
-		  execit.is_collect_finish = 1;
+		  execit->is_collect_finish = 1;
 		}
 	      return true;
 	    }
 	  else
 	    {
 	      *again = true;
-	      execit.is_collect_done = 1;
+	      execit->is_collect_done = 1;
 	    }
 	}
-      else if (execit.is_collect_finish == 1)
+      else if (execit->is_collect_finish == 1)
 	return true;
     }
 
@@ -8824,43 +9731,43 @@ andes_execit_deal_phase (struct bfd_link_info *info, asection *sec,
 }
 
 static void
-andes_execit_reset (bool *again)
+andes_execit_reset (execit_state_t *execit, bool *again)
 {
   /* reset hash and restart EXECIT_1.  */
-  execit.is_collect_again = 0;
-  execit.is_collect_done = 0;
-  execit.is_collect_finish = 0;
+  execit->is_collect_again = 0;
+  execit->is_collect_done = 0;
+  execit->is_collect_finish = 0;
 
   /* hash insn. */
-  execit.is_init = 0;
-  if (execit.code_hash.memory)
+  execit->is_init = 0;
+  if (execit->code_hash.slots)
     {
-      andes_execit_traverse_insn_hash (andes_execit_free);
-      bfd_hash_table_free (&execit.code_hash);
+      andes_execit_traverse_insn_hash (execit, andes_execit_free);
+      andes_execit_hash_free (&execit->code_hash);
     }
 
   /* rank insn.  */
-  if (execit.rank_list)
+  if (execit->rank_list)
     {
       execit_rank_t *p, *pp;
-      p = execit.rank_list;
+      p = execit->rank_list;
       while (p)
 	{
 	  pp = p;
 	  p = p->next;
 	  free (pp);
 	}
-      execit.rank_list = NULL;
+      execit->rank_list = NULL;
     }
 
   /* build itable.  */
-  execit.raw_itable_entries = 0;
-  execit.next_itable_index = 0;
-  execit.is_built = 0;
-  if (execit.itable_array)
+  execit->raw_itable_entries = 0;
+  execit->next_itable_index = 0;
+  execit->is_built = 0;
+  if (execit->itable_array)
     {
-      free (execit.itable_array);
-      execit.itable_array = NULL;
+      free (execit->itable_array);
+      execit->itable_array = NULL;
     }
 
   *again = true;
@@ -8929,9 +9836,6 @@ riscv_relocation_check (struct bfd_link_info *info,
 			asection *sec, bfd_vma *off,
 			bfd_byte *contents, int optimize)
 {
-  /* to track R_RISCV_CALL pals  */
-  static Elf_Internal_Rela *last_rel = NULL;
-  static asection *last_sec = NULL;
   /* We use the highest 1 byte of result to record
      how many bytes location counter has to move.  */
   int result = 0;
@@ -8947,18 +9851,19 @@ riscv_relocation_check (struct bfd_link_info *info,
   execit_loop_aware = andes->execit_loop_aware;
 
   /* if last insn is tagged with R_RISCV_CALL(_PLT), skip the jarl  */
-  while (last_rel)
+  while (table->execit_last_call)
     {
+      Elf_Internal_Rela *last_rel = table->execit_last_call;
       int rtype = ELFNN_R_TYPE (last_rel->r_info);
       if (!(rtype == R_RISCV_CALL || rtype == R_RISCV_CALL_PLT))
 	break;
 
-      BFD_ASSERT (sec == last_sec);
+      BFD_ASSERT (sec == table->execit_last_call_sec);
       BFD_ASSERT (*off == (last_rel->r_offset + 4));
       BFD_ASSERT ((*irel == NULL) || (*irel == irelend)
 		  || ((*irel)->r_offset > *off));
-      last_rel = NULL;
-      last_sec = NULL;
+      table->execit_last_call = NULL;
+      table->execit_last_call_sec = NULL;
       result |= (4 << 24);
       result |= DATA_EXIST;
 
@@ -9123,8 +10028,8 @@ riscv_relocation_check (struct bfd_link_info *info,
 	  if (optimize)
 	    {
 	      irel_save = *irel;
-	      last_rel = *irel;
-	      last_sec = sec;
+	      table->execit_last_call = *irel;
+	      table->execit_last_call_sec = sec;
 	    }
 	  else
 	    {
@@ -9348,6 +10253,7 @@ typedef struct hi20_group_type
 
 typedef struct hi20_context
 {
+  execit_state_t *execit;
   execit_irel_t *p, *q;
   hi20_group_t *hi20s;
   int id;
@@ -9491,6 +10397,7 @@ static int andes_execit_hi20_collect_one (hi20_context_t *ctx)
 
 static int andes_execit_hi20_collect_multiple (hi20_context_t *ctx, int rtype)
 {
+  andes_ld_options_t *andes = &ctx->execit->htab->andes;
   BFD_ASSERT (ctx->p);
   bfd_vma window = SZ_4K;
   execit_itable_t *a = &ctx->p->ie; /* data of node A. */
@@ -9535,8 +10442,8 @@ static int andes_execit_hi20_collect_multiple (hi20_context_t *ctx, int rtype)
       BFD_ASSERT (found == false);
 
       /* transaction: all new group members will have better score.  */
-      if (rtype != R_RISCV_HI20 && nsta.opt && nsta.opt->execit_auipc_entry)
-	entries = nsta.opt->execit_auipc_entry;
+      if (rtype != R_RISCV_HI20 && andes->execit_auipc_entry)
+	entries = andes->execit_auipc_entry;
       else
 	entries = 1;
       entries += window_count + pre_group_count;
@@ -9668,10 +10575,9 @@ andes_execit_sort_irel_list (execit_irel_t **list)
 }
 
 static void
-andes_execit_estimate_hi20 (execit_hash_t *he)
+andes_execit_estimate_hi20 (execit_state_t *execit, execit_hash_t *he)
 {
-  static int group_id = 1; /* 0 for non-grouped.  */
-  hi20_context_t ctx = {.id = group_id};
+  hi20_context_t ctx = {.execit = execit, .id = execit->hi20_group_id};
   int rtype;
 
   BFD_ASSERT (he);
@@ -9704,7 +10610,7 @@ andes_execit_estimate_hi20 (execit_hash_t *he)
     }
 
   andes_execit_estimate_hi20_clean (&ctx);
-  group_id = ctx.id;
+  execit->hi20_group_id = ctx.id;
 }
 
 /*  EXECIT rank list helpers  */
@@ -9730,13 +10636,14 @@ rank_each_cb (void *l ATTRIBUTE_UNUSED, execit_rank_t *j, execit_rank_t *p,
 static bool
 andes_execit_push_insn (execit_context_t *ctx, execit_hash_t* h)
 {
+  execit_state_t *execit = &riscv_elf_hash_table (ctx->info)->execit;
   uint16_t insn16;
   execit_itable_t *e = andes_execit_itable_lookup (ctx, h);
   if (e == NULL)
     return (h->type == ET_RK_TYPE_HI20) ? true : false;
 
   /* replace code.  */
-  insn16 = execit.execit_op | ((execit.execit_op == EXECIT_INSN)
+  insn16 = execit->execit_op | ((execit->execit_op == EXECIT_INSN)
 	     ? ENCODE_RVC_EXECIT_IMM (e->itable_index << 2)
 	     : ENCODE_RVC_NEXECIT_IMM (e->itable_index << 2));
   bfd_put_16 (ctx->abfd, insn16, ctx->contents + ctx->off);
@@ -9745,7 +10652,8 @@ andes_execit_push_insn (execit_context_t *ctx, execit_hash_t* h)
     return false;
 
   /* NOT necessary the one in hash  */
-  if (ctx->irel && !andes_execit_mark_irel (ctx->irel, e->itable_index))
+  if (ctx->irel && !andes_execit_mark_irel (execit, ctx->irel,
+					    e->itable_index))
     return false;
 
   return true;
@@ -9789,7 +10697,7 @@ collect_lui_vma_each_cb(void *l, void *j_pp, execit_irel_t *p, void *q ATTRIBUTE
       /* reserve one more entry in case crossing range.
        * NOT doing so when determining final relocations. 
        */
-      if (execit.is_determining_auipc
+      if (execit->is_determining_auipc
 	  || (p->ie.relocation > SIZE_4K))
 	{
 	  e.vma = p->ie.relocation - SIZE_4K;
@@ -9914,14 +10822,15 @@ execit_push_blank (execit_context_t *ctx, bfd_vma delta, bfd_vma size)
 }
 
 static bool
-andes_execit_mark_irel (Elf_Internal_Rela *irel, int index)
+andes_execit_mark_irel (execit_state_t *execit, Elf_Internal_Rela *irel,
+			int index)
 {
   int rtype = ELFNN_R_TYPE (irel->r_info);
   if (rtype == R_RISCV_HI20 || rtype == R_RISCV_CALL
       || rtype == R_RISCV_PCREL_HI20 || rtype == R_RISCV_JAL)
     {
       andes_irelx_t *irel_ext =
-	andes_extend_irel(irel, R_RISCV_EXECIT_ITE, &execit.irelx_list);
+	andes_extend_irel(irel, R_RISCV_EXECIT_ITE, &execit->irelx_list);
       irel_ext->tag = index;
     }
   else
@@ -9957,8 +10866,9 @@ andes_extend_irel (Elf_Internal_Rela *irel, int subtype,
 static execit_blank_abfd_t*
 execit_lookup_blank_abfd (execit_context_t *ctx)
 {
+  execit_state_t *execit = &riscv_elf_hash_table (ctx->info)->execit;
   execit_blank_abfd_t *p, *q;
-  p = q = execit.blank_list;
+  p = q = execit->blank_list;
 
   while (p)
     {
@@ -9974,7 +10884,7 @@ execit_lookup_blank_abfd (execit_context_t *ctx)
       if (q)
 	q->next = p;
       else
-	execit.blank_list = p;
+	execit->blank_list = p;
       p->abfd = ctx->abfd;
     }
 
@@ -10013,16 +10923,17 @@ execit_lookup_blank_section (execit_context_t *ctx, execit_blank_abfd_t *blank_a
 static bool
 execit_set_itb_base (struct bfd_link_info *link_info)
 {
+  execit_state_t *execit = &riscv_elf_hash_table (link_info)->execit;
   asection *sec;
   bfd *output_bfd = NULL;
   struct bfd_link_hash_entry *bh = NULL;
 
-  if (execit.is_itb_base_set == 1 || link_info->type == type_relocatable)
+  if (execit->is_itb_base_set == 1 || link_info->type == type_relocatable)
     return true;
 
-  execit.is_itb_base_set = 1;
+  execit->is_itb_base_set = 1;
 
-  sec = andes_execit_get_itable_section (link_info->input_bfds);
+  sec = andes_execit_get_itable_section (link_info);
   if (sec != NULL)
     output_bfd = sec->output_section->owner;
 
@@ -10055,9 +10966,10 @@ execit_set_itb_base (struct bfd_link_info *link_info)
 static void
 andes_execit_relocate_itable (struct bfd_link_info *info)
 {
+  execit_state_t *execit = &riscv_elf_hash_table (info)->execit;
   bfd *abfd;
   asection *itable_sec = NULL;
-  execit_item_t *itable = execit.itable_array;
+  execit_item_t *itable = execit->itable_array;
   uint32_t insn, insn_with_reg;
   bfd_byte *contents = NULL;
   int size = 0;
@@ -10067,9 +10979,9 @@ andes_execit_relocate_itable (struct bfd_link_info *info)
   bfd_vma gp;
 
   /* Only need to be done once.  */
-  if (execit.relocate_itable_done)
+  if (execit->relocate_itable_done)
     return;
-  execit.relocate_itable_done = true;
+  execit->relocate_itable_done = true;
 
   table = riscv_elf_hash_table (info);
   andes = &table->andes;
@@ -10090,7 +11002,7 @@ andes_execit_relocate_itable (struct bfd_link_info *info)
   if (andes->execit_import_file && !andes->update_execit_table)
     return;
 
-  itable_sec = andes_execit_get_itable_section (info->input_bfds);
+  itable_sec = andes_execit_get_itable_section (info);
   if (itable_sec == NULL)
     {
       (*_bfd_error_handler) (_("ld: error cannot find .exec.itable section.\n"));
@@ -10112,7 +11024,7 @@ andes_execit_relocate_itable (struct bfd_link_info *info)
 
   /* Relocate instruction.  */
   /* TODO: mark relocated entries to avoid redundancy calculations  */
-  for (int index = 0; index < execit.next_itable_index; ++index)
+  for (int index = 0; index < execit->next_itable_index; ++index)
     {
       execit_item_t *item = &itable[index];
       execit_hash_t *he = item->he;
@@ -10243,7 +11155,7 @@ andes_execit_relocate_itable (struct bfd_link_info *info)
       size += 4;
     }
 
-  size = execit.next_itable_index << 2;
+  size = execit->next_itable_index << 2;
 
   if (!andes->update_execit_table)
     size = itable_sec->size;
@@ -10426,15 +11338,18 @@ riscv_elf_ict_hash_newfunc (struct bfd_hash_entry *entry,
 
 /* Initialize indirect call hash table.  */
 
-static void
+static bool
 riscv_elf_ict_init (void)
 {
   if (!bfd_hash_table_init_n (&nds_ict_sta.indirect_call_table, riscv_elf_ict_hash_newfunc,
 			      sizeof (andes_ict_hash_t),
 			      1023))
-    (*_bfd_error_handler)
-      (_("Linker: cannot init indirect call hash table.\n"));
-  return;
+    {
+      (*_bfd_error_handler)
+	(_("Linker: cannot init indirect call hash table.\n"));
+      return false;
+    }
+  return true;
 }
 
 /* non-invoked ict symbols are not collected in ict list.
@@ -10625,66 +11540,12 @@ andes_relocate_ict_table (struct bfd_link_info *info, bfd *output_bfd)
 
 /* End of ROM Patch with Indirect Call Table (ICT).  */
 
-/* Sort relocation by r_offset.
-   We didn't use qsort () in stdlib, because quick-sort is not a stable sorting
-   algorithm.  Relocations at the same r_offset must keep their order.
-
-   Currently, this function implements insertion-sort.
-
-   FIXME: If we already sort them in assembler, why bother sort them
-   here again?  */
-
-static void
-riscv_insertion_sort (void *base, size_t nmemb, size_t size,
-		      int (*compar) (const void *lhs, const void *rhs))
-{
-  char *ptr = (char *) base;
-  int i, j;
-  char *tmp = malloc (size);
-
-  /* If i is less than j, i is inserted before j.
-
-     |---- j ----- i --------------|
-     \	      / \		  /
-     sorted		unsorted
-  */
-
-  for (i = 1; i < (int) nmemb; i++)
-    {
-      for (j = (i - 1); j >= 0; j--)
-	if (compar (ptr + i * size, ptr + j * size) >= 0)
-	  break;
-      j++;
-
-      if (i == j)
-	continue; /* i is in order.  */
-
-      memcpy (tmp, ptr + i * size, size);
-      memmove (ptr + (j + 1) * size, ptr + j * size, (i - j) * size);
-      memcpy (ptr + j * size, tmp, size);
-    }
-}
-
-static int
-compar_reloc (const void *lhs, const void *rhs)
-{
-  const Elf_Internal_Rela *l = (const Elf_Internal_Rela *) lhs;
-  const Elf_Internal_Rela *r = (const Elf_Internal_Rela *) rhs;
-
-  if (l->r_offset > r->r_offset)
-    return 1;
-  else if (l->r_offset == r->r_offset)
-    return 0;
-  else
-    return -1;
-}
-
 static bool
 andes_relax_execit_ite (
   bfd *abfd,
   asection *sec,
   asection *sym_sec  ATTRIBUTE_UNUSED,
-  struct bfd_link_info *info ATTRIBUTE_UNUSED,
+  struct bfd_link_info *info,
   Elf_Internal_Rela *rel,
   bfd_vma symval,
   bfd_vma max_alignment,
@@ -10694,10 +11555,11 @@ andes_relax_execit_ite (
   void *pcgp_relocs ATTRIBUTE_UNUSED,
   bool undefined_weak ATTRIBUTE_UNUSED)
 {
+  execit_state_t *execit = &riscv_elf_hash_table (info)->execit;
   int execit_index = (int) max_alignment;
   bfd_vma relocation = symval;
   bfd_vma pc = sec_addr (sec) + rel->r_offset;
-  execit_item_t *item = &execit.itable_array[execit_index];
+  execit_item_t *item = &execit->itable_array[execit_index];
   execit_hash_t *he = item->he;
   execit_itable_t *ie = &he->ie;
   Elf_Internal_Rela reduction = *rel;
@@ -10743,7 +11605,7 @@ andes_relax_execit_ite (
 	  item->is_final = true;
 	  item->inf_ie = ie;
 	  item->relocation = hi20;
-	  execit.relocate_itable_done = false;
+	  execit->relocate_itable_done = false;
         }
       else
         {
@@ -10762,7 +11624,7 @@ andes_relax_execit_ite (
 		    }
 		  else if (item->next)
 		    { /* try next  */
-		      item = &execit.itable_array[item->next];
+		      item = &execit->itable_array[item->next];
 		      BFD_ASSERT (item->he == he);
 		      continue;
 		    }
@@ -10784,9 +11646,9 @@ andes_relax_execit_ite (
 	      else
 		{
 		  /* allocate index  */
-		  int index = execit.next_itable_index++;
-		  execit_item_t *t = &execit.itable_array[index];
-		  *t = execit.itable_array[execit_index];
+		  int index = execit->next_itable_index++;
+		  execit_item_t *t = &execit->itable_array[index];
+		  *t = execit->itable_array[execit_index];
 		  t->next = 0;
 		  t->relocation = hi20;
 		  t->inf_ie = ie;
@@ -10795,13 +11657,13 @@ andes_relax_execit_ite (
 		  item->next = index;
 		  item = t;
 
-		  execit.relocate_itable_done = false;
+		  execit->relocate_itable_done = false;
 		}
 	    }
 	}
       /* apply relocation  */
       bfd_byte *contents = elf_section_data (sec)->this_hdr.contents;
-      uint16_t insn16 = execit.execit_op | ((execit.execit_op == EXECIT_INSN)
+      uint16_t insn16 = execit->execit_op | ((execit->execit_op == EXECIT_INSN)
 			  ? ENCODE_RVC_EXECIT_IMM (ie->itable_index << 2)
 			  : ENCODE_RVC_NEXECIT_IMM (ie->itable_index << 2));
       bfd_put_16 (abfd, insn16, contents + rel->r_offset);
@@ -10817,7 +11679,7 @@ andes_relax_execit_ite (
   else if (rtype == R_RISCV_JAL)
     { /* sanity check only  */
       BFD_ASSERT ((pc >> 21) == (ie->relocation >> 21));
-      if (nsta.opt->execit_jal_over_2m
+      if (execit->htab->andes.execit_jal_over_2m
 	  && ((pc >> 21) != (ie->relocation >> 21)))
 	{
 	  reloc_howto_type * r = riscv_elf_rtype_to_howto (abfd, rtype);
@@ -10837,7 +11699,7 @@ andes_relax_execit_ite (
     }
 
   /* record R_RISCV_PCREL_HI20 for pals.  */
-  if (rtype == R_RISCV_JAL && nsta.opt->execit_jal_over_2m)
+  if (rtype == R_RISCV_JAL && execit->htab->andes.execit_jal_over_2m)
     { /* TODO: keep reloc to check in final relocation phase.  */
       rel->r_info = ELFNN_R_INFO (0, R_RISCV_NONE);
     }
@@ -10854,18 +11716,17 @@ riscv_mark_pcgp_hi_reloc (riscv_pcgp_relocs *p,riscv_pcgp_hi_reloc *hi,
 			  bool keep)
 {
   bool out = false;
-  bfd_vma hi_sec_off = hi->hi_sec_off;
   riscv_pcgp_hi_reloc *c;
 
-  for (c = p->hi; c != NULL; c = c->next)
-    if (c->hi_sec_off == hi_sec_off)
-      {
-	out = true;
-	if (keep)
-	  c->is_keep = 1;
-	else
-	  c->is_marked = 1;
-      }
+  for (c = riscv_find_pcgp_hi_reloc (p, hi->hi_sec_off); c != NULL;
+       c = c->same)
+    {
+      out = true;
+      if (keep)
+	c->is_keep = 1;
+      else
+	c->is_marked = 1;
+    }
 
   return out;
 }
@@ -11000,8 +11861,8 @@ andes_relax_pc_gp_insn (
 	    return true;
 	}
       else
-	do_replace = andes_relax_gp_insn (&insn, rel, hi, sym_sec,
-					  symval, gp, data_start);
+	do_replace = andes_relax_gp_insn (&htab->nsta, &insn, rel, hi,
+					  sym_sec, symval, gp, data_start);
 
       if (do_replace)
 	{
@@ -11041,7 +11902,8 @@ andes_min_p2align (Elf_Internal_Rela *rel, asection *sec)
 }
 
 static int
-andes_relax_gp_insn (uint32_t *insn, Elf_Internal_Rela *rel,
+andes_relax_gp_insn (andes_linker_state_t *nsta,
+		     uint32_t *insn, Elf_Internal_Rela *rel,
 		     riscv_pcgp_hi_reloc_t *hi, asection *sym_sec,
 		     bfd_vma symval, bfd_vma gp, bfd_vma data_start)
 {
@@ -11196,7 +12058,7 @@ andes_relax_gp_insn (uint32_t *insn, Elf_Internal_Rela *rel,
 		  rel->r_info = ELFNN_R_INFO (sym, type);
 		  rel->r_addend = hi->hi_addend;
 		}
-	      andes_extend_irel(rel, TAG_GPREL_SUBTYPE_FLX, &nsta.ext_irel_list);
+	      andes_extend_irel(rel, TAG_GPREL_SUBTYPE_FLX, &nsta->ext_irel_list);
 	      *insn = (*insn & ~(OP_MASK_RS1 << OP_SH_RS1)) | (GPR_ABI_GP << OP_SH_RS1);
 	    }
 	  else if (((*insn & MASK_FSH) == MATCH_FSH
@@ -11210,7 +12072,7 @@ andes_relax_gp_insn (uint32_t *insn, Elf_Internal_Rela *rel,
 		  rel->r_info = ELFNN_R_INFO (sym, type);
 		  rel->r_addend = hi->hi_addend;
 		}
-	      andes_extend_irel(rel, TAG_GPREL_SUBTYPE_FSX, &nsta.ext_irel_list);
+	      andes_extend_irel(rel, TAG_GPREL_SUBTYPE_FSX, &nsta->ext_irel_list);
 	      *insn = (*insn & ~(OP_MASK_RS1 << OP_SH_RS1)) | (GPR_ABI_GP << OP_SH_RS1);
 	    }
 	  else
@@ -11266,10 +12128,10 @@ riscv_elf_output_symbol_hook (struct bfd_link_info *info,
   if (input_sec->flags & SEC_EXCLUDE)
     return true;
 
-  if (!nsta.check_start_export_sym)
+  if (!table->nsta.check_start_export_sym)
     {
       fprintf (sym_ld_script, "SECTIONS\n{\n");
-      nsta.check_start_export_sym = 1;
+      table->nsta.check_start_export_sym = 1;
       /* dump ICT table if necessary  */
       andes_ict_entry_t *p = nds_ict_sta.list_head;
       if (p)
@@ -11335,7 +12197,7 @@ riscv_elf_output_arch_syms (bfd *output_bfd ATTRIBUTE_UNUSED,
   andes = &table->andes;
   sym_ld_script = andes->sym_ld_script;
 
-  if (nsta.check_start_export_sym)
+  if (table->nsta.check_start_export_sym)
     fprintf (sym_ld_script, "}\n");
 
   return true;
@@ -11404,7 +12266,7 @@ _bfd_riscv_relax_align_btb (bfd *abfd, asection *sec,
 			    bfd_vma max_alignment ATTRIBUTE_UNUSED,
 			    bfd_vma reserve_size ATTRIBUTE_UNUSED,
 			    bool *again ATTRIBUTE_UNUSED,
-			    riscv_pcgp_relocs *pcgp_relocs ATTRIBUTE_UNUSED,
+			    riscv_pcgp_relocs *pcgp_relocs,
 			    bool undefined_weak ATTRIBUTE_UNUSED)
 {
   link_hash_table_t *htab = riscv_elf_hash_table (info);
@@ -11429,7 +12291,7 @@ _bfd_riscv_relax_align_btb (bfd *abfd, asection *sec,
       if (symval & 3)
 	{
 	  BFD_ASSERT ((symval & 3) == 2);
-	  bfd_vma offset = nsta.prev_aligned_offset;
+	  bfd_vma offset = pcgp_relocs->prev_aligned_offset;
 	  bfd_vma end = rel->r_offset;
 	  filled = andes_try_target_align (abfd, sec, sym_sec, info, rel,
 					   offset, end);
@@ -11437,7 +12299,7 @@ _bfd_riscv_relax_align_btb (bfd *abfd, asection *sec,
 	  rel->r_addend -= filled;
 
 	}
-      nsta.prev_aligned_offset = rel->r_offset;
+      pcgp_relocs->prev_aligned_offset = rel->r_offset;
     }
 
   /* Delete the reloc.  */
@@ -167,6 +167,9 @@ typedef struct
   int tbljt_count2; /* by block (8-entry) */
   int tbljalt_count;
   int *accumulation;
+  /* The id of the last entry created, which orders the entries of equal
+     benefit.  */
+  int last_id;
 
   /* debug use.  */
   unsigned int *savings;
@@ -297,12 +300,15 @@ typedef struct andes_ld_options
   int set_relax_cross_section_call;
   /* Defalut do workaround.  */
   int set_workaround;
+  /* Default defer byte deletions to the end of each relax pass.  */
+  int set_relax_defer_delete;
   /* Default page size  */
   int set_relax_page_size;
   /* For EXECIT.  */
   /* exec.it options  */
   FILE *execit_import_file;
   char *execit_export_file;
+  char *execit_cache_file;
   int target_optimization;
   int execit_limit;
   int execit_auipc_entry;
@@ -321,6 +327,7 @@ typedef struct andes_ld_options
   uint keep_import_execit:1;
   uint execit_loop_aware:1;
   uint execit_jal_over_2m:1; /* enable JAL over first 2M window.  */
+  uint table_jump_stats:1; /* report the ranked table jump entries.  */
   /* andes internal options.  */
   uint set_table_jump:1;
   uint set_table_jump_cli:1;
@@ -366,9 +373,25 @@ typedef struct execit_vma_entry
   bfd_vma vma;
 } execit_vma_t;
 
+/* Binary key of an exec.it candidate: the fixed parts of the insn and
+   the identity of its relocation.  The relocation is kept as section and
+   offset instead of VMA to merge aliases.  */
+typedef struct execit_hash_key
+{
+  uint32_t fixed;	/* opcode|registers  */
+  uint32_t symbol;	/* EXECIT_KEY_ABS/LAB/SYM  */
+  bfd_vma rel_section;	/* owner of the symbol  */
+  bfd_vma rel_offset;	/* offset of symbol, or offset/(lui, auipc)  */
+} execit_hash_key_t;
+
+#define EXECIT_KEY_ABS 0 /* constant  */
+#define EXECIT_KEY_LAB 1 /* local symbol  */
+#define EXECIT_KEY_SYM 2 /* global symbol  */
+
 typedef struct execit_hash_entry
 {
-  struct bfd_hash_entry root;
+  execit_hash_key_t key;
+  hashval_t hash;
   execit_itable_t ie;
   execit_irel_t *irels;
   execit_vma_t *vmas;
@@ -379,6 +402,19 @@ typedef struct execit_hash_entry
   uint is_imported:1;
 } execit_hash_t;
 
+/* Open-addressed table of exec.it candidates.  The entries live in a pool
+   of fixed size blocks so that they never move, and are numbered in their
+   creation order by ID.  SLOTS holds ID + 1 of the entries, 0 if empty.  */
+#define EXECIT_POOL_BLOCK 1024
+
+typedef struct execit_code_hash
+{
+  execit_hash_t **blocks;
+  unsigned int *slots;
+  unsigned int size;	/* number of slots, a power of 2  */
+  unsigned int count;	/* number of entries  */
+} execit_code_hash_t;
+
 typedef struct execit_itable_item
 {
   execit_hash_t *he;
@@ -442,47 +478,9 @@ typedef struct execit_context
   Elf_Internal_Rela *irel;
   bfd_byte *contents;
   bfd_vma off;
-  char buf[0x400];
+  execit_hash_key_t key;
 } execit_context_t;
 
-typedef struct ict_state
-{
-  uint is_init:1;
-} ict_state_t;
-
-struct riscv_elf_link_hash_table
-{
-  struct elf_link_hash_table elf;
-
-  /* Short-cuts to get to dynamic linker sections.  */
-  asection *sdyntdata;
-
-  /* The max alignment of output sections.  */
-  bfd_vma max_alignment;
-
-  /* Used by local STT_GNU_IFUNC symbols.  */
-  htab_t loc_hash_table;
-  void * loc_hash_memory;
-
-  /* The index of the last unused .rel.iplt slot.  */
-  bfd_vma last_iplt_index;
-
-  /* The data segment phase, don't relax the section
-     when it is exp_seg_relro_adjust.  */
-  int *data_segment_phase;
-
-  /* Relocations for variant CC symbols may be present.  */
-  int variant_cc;
-
-  /* { Andes  */
-  andes_ld_options_t andes;
-  /* } Andes  */
-
-  riscv_table_jump_htab_t *table_jump_htab;
-};
-
-typedef struct riscv_elf_link_hash_table link_hash_table_t;
-
 /* ICT stuff  */
 #define ANDES_ICT_SECTION ".nds.ict"
 
@@ -576,6 +574,31 @@ typedef struct ace_operand
   const char *hw_name;  /* hardware/register name */
 } ace_op_t;
 
+/* An ACE operand field of an ACE opcode, compiled from its "X<name>"
+   description when the ACE library is loaded.  The bit-field may be
+   discrete, given as "<name><msb>_<width>|<msb>_<width>..." parts from
+   the least significant one.  The parts are allocated with the field,
+   as many as the description has.  */
+typedef struct ace_field
+{
+  const char *arg;	/* the 'X' in the args of the opcode.  */
+  const char *end;	/* the ',' or '\0' ending the field.  */
+  const ace_op_t *op;	/* NULL if unknown.  */
+  unsigned int nparts;	/* 0 if not discrete.  */
+  struct
+  {
+    unsigned char msb;
+    unsigned char width;
+  } parts[];
+} ace_field_t;
+
+/* Defined with the ACE loader in opcodes, shared by gas and gdb.  */
+extern const ace_field_t *andes_ace_field (const char *arg);
+extern unsigned int andes_ace_extract (const ace_field_t *field,
+				       uint64_t insn);
+extern uint64_t andes_ace_insert (const ace_field_t *field,
+				  unsigned int value);
+
 /* GP relative insn relaxation */
 #define GPR_ABI_GP 3
 #define TAG_NONE 0
@@ -605,13 +628,17 @@ typedef struct execit_state
   andes_irelx_t *irelx_list;
   execit_item_t *itable_array;
   struct riscv_elf_link_hash_table *htab;
-  struct bfd_hash_table code_hash;
+  execit_code_hash_t code_hash;
+  /* Candidate scans of the input sections, by content.  */
+  htab_t scan_cache;
   bfd_vma jal_window_end;
   bfd_vma prev_gp;
   bfd_vma curr_gp;
   int raw_itable_entries;
   int next_itable_index;
   int import_number;
+  uint irel_id;
+  int hi20_group_id;
   uint16_t execit_op;
   uint is_init:1;
   uint is_built:1;
@@ -634,11 +661,63 @@ typedef struct andes_linker_state
 {
   andes_ld_options_t *opt;
   andes_irelx_t *ext_irel_list;
-  bfd_vma prev_aligned_offset;
   uint check_start_export_sym:1;
   uint use_table_jump:1;
 } andes_linker_state_t;
 /* } Andes  */
 
+struct riscv_elf_link_hash_table
+{
+  struct elf_link_hash_table elf;
+
+  /* Short-cuts to get to dynamic linker sections.  */
+  asection *sdyntdata;
+
+  /* The max alignment of output sections.  */
+  bfd_vma max_alignment;
+
+  /* Used by local STT_GNU_IFUNC symbols.  */
+  htab_t loc_hash_table;
+  void * loc_hash_memory;
+
+  /* The index of the last unused .rel.iplt slot.  */
+  bfd_vma last_iplt_index;
+
+  /* The data segment phase, don't relax the section
+     when it is exp_seg_relro_adjust.  */
+  int *data_segment_phase;
+
+  /* Relocations for variant CC symbols may be present.  */
+  int variant_cc;
+
+  /* { Andes  */
+  andes_ld_options_t andes;
+
+  /* Relaxation state shared by all the input sections of the link.
+     What only concerns the section being relaxed is kept by
+     _bfd_riscv_relax_section itself, so that the sections of a relax
+     pass never depend on each other's partial results.  */
+  execit_state_t execit;
+  andes_linker_state_t nsta;
+  struct relax_gp_sym_info *relax_gp_sym_info_head;
+  /* Number of relax_section rounds, counted at PASS_DELETE_ORG.  */
+  int relax_rounds;
+  uint relax_init:1;
+  uint check_relocs_init:1;
+  /* Whether the indirect call hash table is set up for this link, and
+     whether the ict table has been relocated.  */
+  uint ict_init:1;
+  uint ict_fini:1;
+  /* The R_RISCV_CALL(_PLT) whose jalr riscv_relocation_check skips next,
+     and its section.  */
+  Elf_Internal_Rela *execit_last_call;
+  asection *execit_last_call_sec;
+  /* } Andes  */
+
+  riscv_table_jump_htab_t *table_jump_htab;
+};
+
+typedef struct riscv_elf_link_hash_table link_hash_table_t;
+
 extern int
 riscv_get_base_spimm (insn_t, riscv_parse_subset_t *);
@@ -914,3 +914,116 @@ _bfd_stringtab_emit (bfd *abfd, struct bfd_strtab_hash *tab)
 
   return true;
 }
+
+/* Return the byte DEPTH bytes before the end of S, plus one, or zero
+   if S is no longer than DEPTH.  */
+
+static inline int
+revstr_key (const struct bfd_revstr *s, size_t depth)
+{
+  return depth < s->len ? s->end[-1 - (ptrdiff_t) depth] + 1 : 0;
+}
+
+/* Compare A and B from their ends, given that their last DEPTH bytes
+   are equal.  A string sorts before any longer string it is a suffix
+   of.  */
+
+static int
+revstr_cmp (const struct bfd_revstr *a, const struct bfd_revstr *b,
+	    size_t depth)
+{
+  size_t l = a->len < b->len ? a->len : b->len;
+  const unsigned char *s = a->end - depth;
+  const unsigned char *t = b->end - depth;
+
+  for (; depth < l; depth++)
+    {
+      --s;
+      --t;
+      if (*s != *t)
+	return (int) *s - (int) *t;
+    }
+  return a->len < b->len ? -1 : a->len > b->len;
+}
+
+/* Sort the N strings at A, whose last DEPTH bytes are all equal.
+   This is a multikey quicksort: each pass partitions on a single
+   byte, so a suffix shared by many strings is only looked at once
+   rather than on every comparison.  */
+
+static void
+revstr_sort (struct bfd_revstr *a, size_t n, size_t depth)
+{
+  while (n > 1)
+    {
+      struct bfd_revstr tmp;
+      size_t lt, gt, i;
+      int k0, k1, k2, pivot;
+
+      if (n < 16)
+	{
+	  for (i = 1; i < n; i++)
+	    {
+	      size_t j = i;
+
+	      tmp = a[i];
+	      for (; j > 0 && revstr_cmp (&a[j - 1], &tmp, depth) > 0; j--)
+		a[j] = a[j - 1];
+	      a[j] = tmp;
+	    }
+	  return;
+	}
+
+      /* Partition around the median of three keys into bytes less
+	 than, equal to and greater than the pivot.  */
+      k0 = revstr_key (&a[0], depth);
+      k1 = revstr_key (&a[n / 2], depth);
+      k2 = revstr_key (&a[n - 1], depth);
+      if (k0 > k1)
+	pivot = k0, k0 = k1, k1 = pivot;
+      pivot = k2 < k0 ? k0 : k2 > k1 ? k1 : k2;
+
+      lt = 0;
+      gt = n;
+      i = 0;
+      while (i < gt)
+	{
+	  int k = revstr_key (&a[i], depth);
+
+	  if (k < pivot)
+	    {
+	      tmp = a[lt];
+	      a[lt++] = a[i];
+	      a[i++] = tmp;
+	    }
+	  else if (k > pivot)
+	    {
+	      tmp = a[--gt];
+	      a[gt] = a[i];
+	      a[i] = tmp;
+	    }
+	  else
+	    i++;
+	}
+
+      revstr_sort (a, lt, depth);
+      revstr_sort (a + gt, n - gt, depth);
+
+      /* Strings that all end at DEPTH are equal.  */
+      if (pivot == 0)
+	return;
+      a += lt;
+      n = gt - lt;
+      depth++;
+    }
+}
+
+/* Sort the COUNT strings in ARRAY by their bytes read backwards from
+   the end, so that each string is followed by those it could be a
+   suffix of.  This is the order string table tail merging needs.  */
+
+void
+_bfd_sort_reversed_strings (struct bfd_revstr *array, size_t count)
+{
+  revstr_sort (array, count, 0);
+}
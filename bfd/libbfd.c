@@ -23,6 +23,10 @@
 #include "bfd.h"
 #include "libbfd.h"
 
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
+
 #ifndef HAVE_GETPAGESIZE
 #define getpagesize() 2048
 #endif
@@ -1056,6 +1060,73 @@ _bfd_generic_get_section_contents_in_window
 #endif
 }
 
+/* Mapping a region costs a system call and a page fault per page, which
+   only pays off over a plain read for large regions.  */
+#define MMAP_READONLY_MIN_SIZE (64 * 1024)
+
+/* Map SIZE bytes at POS in ABFD read-only, if ABFD was opened with
+   BFD_MMAP_CONTENTS and the region is large enough.  Return the mapped
+   bytes, and set *MAP_ADDR and *MAP_SIZE for _bfd_munmap_readonly, or
+   return NULL if the region should be read instead.  */
+
+void *
+_bfd_mmap_readonly (bfd *abfd ATTRIBUTE_UNUSED,
+		    ufile_ptr pos ATTRIBUTE_UNUSED,
+		    bfd_size_type size ATTRIBUTE_UNUSED,
+		    void **map_addr ATTRIBUTE_UNUSED,
+		    bfd_size_type *map_size ATTRIBUTE_UNUSED)
+{
+#ifdef HAVE_MMAP
+  ufile_ptr filesize;
+  bfd *file;
+  void *ret;
+
+  if ((abfd->flags & BFD_MMAP_CONTENTS) == 0
+      || abfd->direction != read_direction
+      || size < MMAP_READONLY_MIN_SIZE)
+    return NULL;
+
+  /* Only map real files.  */
+  for (file = abfd; file != NULL; file = file->my_archive)
+    {
+      if ((file->flags & BFD_IN_MEMORY) != 0)
+	return NULL;
+      if (file->my_archive != NULL && bfd_is_thin_archive (file->my_archive))
+	break;
+    }
+
+  /* Touching a mapping beyond the end of the file raises SIGBUS.  */
+  filesize = bfd_get_file_size (abfd);
+  if (filesize == 0 || pos > filesize || size > filesize - pos)
+    return NULL;
+
+  ret = bfd_mmap (abfd, NULL, size, PROT_READ, MAP_PRIVATE, pos,
+		  map_addr, map_size);
+  if (ret == (void *) -1)
+    {
+      bfd_set_error (bfd_error_no_error);
+      return NULL;
+    }
+  return ret;
+#else
+  return NULL;
+#endif
+}
+
+/* Unmap a region mapped by _bfd_mmap_readonly.  */
+
+void
+_bfd_munmap_readonly (void *map_addr ATTRIBUTE_UNUSED,
+		      bfd_size_type map_size ATTRIBUTE_UNUSED)
+{
+#ifdef HAVE_MMAP
+  if (munmap (map_addr, map_size) != 0)
+    abort ();
+#else
+  abort ();
+#endif
+}
+
 /* This generic function can only be used in implementations where creating
    NEW sections is disallowed.  It is useful in patching existing sections
    in read-write files, though.  See other set_section_contents functions
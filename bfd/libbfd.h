@@ -284,6 +284,9 @@ extern bool _bfd_generic_get_section_contents
   (bfd *, asection *, void *, file_ptr, bfd_size_type) ATTRIBUTE_HIDDEN;
 extern bool _bfd_generic_get_section_contents_in_window
   (bfd *, asection *, bfd_window *, file_ptr, bfd_size_type) ATTRIBUTE_HIDDEN;
+extern void *_bfd_mmap_readonly
+  (bfd *, ufile_ptr, bfd_size_type, void **, bfd_size_type *) ATTRIBUTE_HIDDEN;
+extern void _bfd_munmap_readonly (void *, bfd_size_type) ATTRIBUTE_HIDDEN;
 
 /* Generic routines to use for BFD_JUMP_TABLE_COPY.  Use
    BFD_JUMP_TABLE_COPY (_bfd_generic).  */
@@ -778,6 +781,21 @@ extern bfd_size_type _bfd_stringtab_add
 /* Write out a string table.  */
 extern bool _bfd_stringtab_emit
   (bfd *, struct bfd_strtab_hash *) ATTRIBUTE_HIDDEN;
+
+/* A string to be sorted by _bfd_sort_reversed_strings.  */
+struct bfd_revstr
+{
+  /* One past the last byte of the string.  */
+  const unsigned char *end;
+  /* The length of the string.  */
+  size_t len;
+  /* The caller's entry for the string.  */
+  void *entry;
+};
+
+/* Sort strings by their bytes read from the end.  */
+extern void _bfd_sort_reversed_strings
+  (struct bfd_revstr *, size_t) ATTRIBUTE_HIDDEN;
 
 /* Macros to tell if bfds are read or write enabled.
 
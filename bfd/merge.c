@@ -559,39 +559,18 @@ record_section (struct sec_merge_info *sinfo,
   return false;
 }
 
-/* qsort comparison function.  Won't ever return zero as all entries
-   differ, so there is no issue with qsort stability here.  */
-
-static int
-strrevcmp (const void *a, const void *b)
-{
-  struct sec_merge_hash_entry *A = *(struct sec_merge_hash_entry **) a;
-  struct sec_merge_hash_entry *B = *(struct sec_merge_hash_entry **) b;
-  unsigned int lenA = A->len;
-  unsigned int lenB = B->len;
-  const unsigned char *s = (const unsigned char *) A->root.string + lenA - 1;
-  const unsigned char *t = (const unsigned char *) B->root.string + lenB - 1;
-  int l = lenA < lenB ? lenA : lenB;
-
-  while (l)
-    {
-      if (*s != *t)
-	return (int) *s - (int) *t;
-      s--;
-      t--;
-      l--;
-    }
-  return lenA - lenB;
-}
-
-/* Like strrevcmp, but for the case where all strings have the same
-   alignment > entsize.  */
+/* qsort comparison function, for the case where all strings have the
+   same alignment > entsize.  Sort by the length modulo the alignment,
+   then like _bfd_sort_reversed_strings.  Won't ever return zero as all
+   entries differ, so there is no issue with qsort stability here.  */
 
 static int
 strrevcmp_align (const void *a, const void *b)
 {
-  struct sec_merge_hash_entry *A = *(struct sec_merge_hash_entry **) a;
-  struct sec_merge_hash_entry *B = *(struct sec_merge_hash_entry **) b;
+  const struct bfd_revstr *RA = (const struct bfd_revstr *) a;
+  const struct bfd_revstr *RB = (const struct bfd_revstr *) b;
+  struct sec_merge_hash_entry *A = (struct sec_merge_hash_entry *) RA->entry;
+  struct sec_merge_hash_entry *B = (struct sec_merge_hash_entry *) RB->entry;
   unsigned int lenA = A->len;
   unsigned int lenB = B->len;
   const unsigned char *s = (const unsigned char *) A->root.string + lenA - 1;
@@ -631,23 +610,27 @@ is_suffix (const struct sec_merge_hash_entry *A,
 static struct sec_merge_sec_info *
 merge_strings (struct sec_merge_info *sinfo)
 {
-  struct sec_merge_hash_entry **array, **a, *e;
+  struct sec_merge_hash_entry *e, **pe;
+  struct bfd_revstr *array, *a;
   struct sec_merge_sec_info *secinfo;
   bfd_size_type size, amt;
   unsigned int alignment = 0;
 
   /* Now sort the strings */
-  amt = sinfo->htab->size * sizeof (struct sec_merge_hash_entry *);
-  array = (struct sec_merge_hash_entry **) bfd_malloc (amt);
+  amt = sinfo->htab->size * sizeof (struct bfd_revstr);
+  array = (struct bfd_revstr *) bfd_malloc (amt);
   if (array == NULL)
     return NULL;
 
   for (e = sinfo->htab->first, a = array; e; e = e->next)
     if (e->alignment)
       {
-	*a++ = e;
 	/* Adjust the length to not include the zero terminator.  */
 	e->len -= sinfo->htab->entsize;
+	a->end = (const unsigned char *) e->root.string + e->len;
+	a->len = e->len;
+	a->entry = e;
+	a++;
 	if (alignment != e->alignment)
 	  {
 	    if (alignment == 0)
@@ -660,17 +643,19 @@ merge_strings (struct sec_merge_info *sinfo)
   sinfo->htab->size = a - array;
   if (sinfo->htab->size != 0)
     {
-      qsort (array, (size_t) sinfo->htab->size,
-	     sizeof (struct sec_merge_hash_entry *),
-	     (alignment != (unsigned) -1 && alignment > sinfo->htab->entsize
-	      ? strrevcmp_align : strrevcmp));
+      if (alignment != (unsigned) -1 && alignment > sinfo->htab->entsize)
+	qsort (array, (size_t) sinfo->htab->size, sizeof (struct bfd_revstr),
+	       strrevcmp_align);
+      else
+	_bfd_sort_reversed_strings (array, (size_t) sinfo->htab->size);
 
       /* Loop over the sorted array and merge suffixes */
-      e = *--a;
+      e = (struct sec_merge_hash_entry *) (--a)->entry;
       e->len += sinfo->htab->entsize;
       while (--a >= array)
 	{
-	  struct sec_merge_hash_entry *cmp = *a;
+	  struct sec_merge_hash_entry *cmp
+	    = (struct sec_merge_hash_entry *) a->entry;
 
 	  cmp->len += sinfo->htab->entsize;
 	  if (e->alignment >= cmp->alignment
@@ -713,12 +698,12 @@ merge_strings (struct sec_merge_info *sinfo)
 
   /* And now adjust the rest, removing them from the chain (but not hashtable)
      at the same time.  */
-  for (a = &sinfo->htab->first, e = *a; e; e = e->next)
+  for (pe = &sinfo->htab->first, e = *pe; e; e = e->next)
     if (e->alignment)
-      a = &e->next;
+      pe = &e->next;
     else
       {
-	*a = e->next;
+	*pe = e->next;
 	if (e->len)
 	  {
 	    e->secinfo = e->u.suffix->secinfo;
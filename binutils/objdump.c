@@ -3265,6 +3265,8 @@ disassemble_section (bfd *abfd, asection *section, void *inf)
   unsigned int opb = pinfo->octets_per_byte;
   bfd_byte *data = NULL;
   bfd_size_type datasize = 0;
+  void *map_addr;
+  bfd_size_type map_size;
   arelent **rel_pp = NULL;
   arelent **rel_ppstart = NULL;
   arelent **rel_ppend;
@@ -3358,7 +3360,7 @@ disassemble_section (bfd *abfd, asection *section, void *inf)
     }
   rel_ppend = PTR_ADD (rel_pp, rel_count);
 
-  if (!bfd_malloc_and_get_section (abfd, section, &data))
+  if (!bfd_map_section_contents (abfd, section, &data, &map_addr, &map_size))
     {
       non_fatal (_("Reading section %s failed because: %s"),
 		 section->name, bfd_errmsg (bfd_get_error ()));
@@ -3615,7 +3617,7 @@ disassemble_section (bfd *abfd, asection *section, void *inf)
       sym = nextsym;
     }
 
-  free (data);
+  bfd_unmap_section_contents (data, map_addr, map_size);
 
   if (rel_ppstart != NULL)
     free (rel_ppstart);
@@ -4486,6 +4488,8 @@ dump_section (bfd *abfd, asection *section, void *dummy ATTRIBUTE_UNUSED)
 {
   bfd_byte *data = NULL;
   bfd_size_type datasize;
+  void *map_addr;
+  bfd_size_type map_size;
   bfd_vma addr_offset;
   bfd_vma start_offset;
   bfd_vma stop_offset;
@@ -4534,7 +4538,7 @@ dump_section (bfd *abfd, asection *section, void *dummy ATTRIBUTE_UNUSED)
 	    (unsigned long) (section->filepos + start_offset));
   printf ("\n");
 
-  if (!bfd_get_full_section_contents (abfd, section, &data))
+  if (!bfd_map_section_contents (abfd, section, &data, &map_addr, &map_size))
     {
       non_fatal (_("Reading section %s failed because: %s"),
 		 section->name, bfd_errmsg (bfd_get_error ()));
@@ -4606,7 +4610,7 @@ dump_section (bfd *abfd, asection *section, void *dummy ATTRIBUTE_UNUSED)
 	}
       putchar ('\n');
     }
-  free (data);
+  bfd_unmap_section_contents (data, map_addr, map_size);
 }
 
 /* Actually display the various requested regions.  */
@@ -5270,6 +5274,10 @@ display_any_bfd (bfd *file, int level)
   if (!dump_section_contents)
     file->flags |= BFD_DECOMPRESS;
 
+  /* Sections are only read to be dumped or disassembled, so large ones
+     can be mapped rather than copied.  */
+  file->flags |= BFD_MMAP_CONTENTS;
+
   /* If the file is an archive, process all of its elements.  */
   if (bfd_check_format (file, bfd_archive))
     {
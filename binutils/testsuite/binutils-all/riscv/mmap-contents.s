@@ -0,0 +1,17 @@
+	# More than 64K of code and data, which objdump maps from the
+	# file rather than reading into memory.
+	.option norvc
+	.text
+	.set	n, 0
+	.rept	20000
+	lui	a0, n
+	.set	n, n + 1
+	.endr
+	ret
+
+	.data
+	.set	n, 0
+	.rept	20000
+	.byte	0xda, 0x7a, n >> 8, n & 0xff
+	.set	n, n + 1
+	.endr
@@ -265,14 +265,14 @@ Options:\n\
   --alternate             initially turn on alternate macro syntax\n"));
 #ifdef DEFAULT_FLAG_COMPRESS_DEBUG
   fprintf (stream, _("\
-  --compress-debug-sections[={none|zlib|zlib-gnu|zlib-gabi}]\n\
+  --compress-debug-sections[={none|zlib|zlib-gnu|zlib-gabi}[,level=N]]\n\
                           compress DWARF debug sections using zlib [default]\n"));
   fprintf (stream, _("\
   --nocompress-debug-sections\n\
                           don't compress DWARF debug sections\n"));
 #else
   fprintf (stream, _("\
-  --compress-debug-sections[={none|zlib|zlib-gnu|zlib-gabi}]\n\
+  --compress-debug-sections[={none|zlib|zlib-gnu|zlib-gabi}[,level=N]]\n\
                           compress DWARF debug sections using zlib\n"));
   fprintf (stream, _("\
   --nocompress-debug-sections\n\
@@ -741,17 +741,37 @@ This program has absolutely no warranty.\n"));
 	  if (optarg)
 	    {
 #if defined OBJ_ELF || defined OBJ_MAYBE_ELF
-	      if (strcasecmp (optarg, "none") == 0)
+	      char *type = xstrdup (optarg);
+	      char *level = strchr (type, ',');
+
+	      if (level != NULL)
+		*level++ = '\0';
+	      if (strcasecmp (type, "none") == 0)
 		flag_compress_debug = COMPRESS_DEBUG_NONE;
-	      else if (strcasecmp (optarg, "zlib") == 0)
+	      else if (strcasecmp (type, "zlib") == 0)
 		flag_compress_debug = COMPRESS_DEBUG_GABI_ZLIB;
-	      else if (strcasecmp (optarg, "zlib-gnu") == 0)
+	      else if (strcasecmp (type, "zlib-gnu") == 0)
 		flag_compress_debug = COMPRESS_DEBUG_GNU_ZLIB;
-	      else if (strcasecmp (optarg, "zlib-gabi") == 0)
+	      else if (strcasecmp (type, "zlib-gabi") == 0)
 		flag_compress_debug = COMPRESS_DEBUG_GABI_ZLIB;
 	      else
 		as_fatal (_("Invalid --compress-debug-sections option: `%s'"),
 			  optarg);
+
+	      /* A lower zlib level trades size for assembly time.  */
+	      if (level != NULL)
+		{
+		  char *end = level;
+		  long n = -1;
+
+		  if (startswith (level, "level="))
+		    n = strtol (level + 6, &end, 10);
+		  if (n < 1 || n > 9 || *end != '\0')
+		    as_fatal (_("Invalid --compress-debug-sections option: `%s'"),
+			      optarg);
+		  flag_compress_debug_level = n;
+		}
+	      free (type);
 #else
 	      as_fatal (_("--compress-debug-sections=%s is unsupported"),
 			optarg);
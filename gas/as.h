@@ -323,6 +323,10 @@ COMMON int flag_traditional_format;
 /* Type of compressed debug sections we should generate.   */
 COMMON enum compressed_debug_section_type flag_compress_debug;
 
+/* The zlib level to compress debug sections with, from 1 to 9, or 0
+   for the zlib default.  */
+COMMON int flag_compress_debug_level;
+
 /* TRUE if .note.GNU-stack section with SEC_CODE should be created */
 COMMON int flag_execstack;
 
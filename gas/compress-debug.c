@@ -24,17 +24,18 @@
 #include "ansidecl.h"
 #include "compress-debug.h"
 
-/* Initialize the compression engine.  */
+/* Initialize the compression engine at LEVEL, or at the zlib default
+   if LEVEL is 0.  */
 
 struct z_stream_s *
-compress_init (void)
+compress_init (int level)
 {
   static struct z_stream_s strm;
 
   strm.zalloc = NULL;
   strm.zfree = NULL;
   strm.opaque = NULL;
-  deflateInit (&strm, Z_DEFAULT_COMPRESSION);
+  deflateInit (&strm, level != 0 ? level : Z_DEFAULT_COMPRESSION);
   return &strm;
 }
 
@@ -25,7 +25,7 @@ struct z_stream_s;
 
 /* Initialize the compression engine.  */
 extern struct z_stream_s *
-compress_init (void);
+compress_init (int);
 
 /* Stream the contents of a frag to the compression engine.  Output
    from the engine goes into the current frag on the obstack.  */
@@ -242,7 +242,6 @@ static struct andes_as_states
 extern char *andes_ace_load_hooks (const char *arg);
 /* Hash table for storing symbols from shared library */
 static htab_t ace_keyword_hash = NULL;
-static htab_t ace_op_hash = NULL;
 /* Pointers for storing symbols from ACE shared library */
 extern struct riscv_opcode *ace_opcs;
 extern ace_keyword_t *ace_keys;
@@ -283,6 +282,9 @@ riscv_aligned_cons (int idx);
 static void
 macro_build (expressionS *ep, const char *name, const char *fmt, ...);
 static void
+riscv_append_insn (struct riscv_cl_insn *insn, expressionS *imm_expr,
+		   bfd_reloc_code_real_type imm_reloc);
+static void
 riscv_make_nops (char *buf, bfd_vma bytes);
 /* } Andes */
 
@@ -1991,23 +1993,6 @@ md_begin (void)
 	    }
 	  i++;
 	}
-
-      /* Insert operand field information in a hash table */
-      ace_op_hash = str_htab_create ();
-      i = 0;
-      while (ace_ops[i].name)
-	{
-	  const char *name = ace_ops[i].name;
-	  struct riscv_opcode **hash_error = (struct riscv_opcode **)
-	    str_hash_insert (ace_op_hash, name, (void *) &ace_ops[i], 0);
-	  if (hash_error)
-	    {
-	      fprintf (stderr, _("internal error: can't hash `%s': %s\n"),
-		       name, (*hash_error)->name);
-	      as_fatal (_("Broken assembler.  No assembly attempted."));
-	    }
-	  i++;
-	}
     }
   /* } Andes ACE */
 }
@@ -2494,29 +2479,6 @@ macro_build (expressionS *ep, const char *name, const char *fmt, ...)
   append_insn (&insn, ep, r);
 }
 
-/* Build an instruction created by a macro expansion.  Like md_assemble but
-   accept a printf-style format string and arguments.  */
-
-static void
-md_assemblef (const char *format, ...)
-{
-  char *buf = NULL;
-  va_list ap;
-  int r;
-
-  va_start (ap, format);
-
-  r = vasprintf (&buf, format, ap);
-
-  if (r < 0)
-    as_fatal (_("internal: vasprintf failed"));
-
-  md_assemble (buf);
-  free(buf);
-
-  va_end (ap);
-}
-
 /* Sign-extend 32-bit mode constants that have bit 31 set and all higher bits
    unset.  */
 
@@ -2549,6 +2511,244 @@ check_absolute_expr (struct riscv_cl_insn *ip, expressionS *ex,
   normalize_constant_expr (ex);
 }
 
+/* An operand of an instruction built by macro_assemble, either a register
+   number or a constant.  */
+
+struct riscv_macro_operand
+{
+  bool reg;
+  offsetT value;
+};
+
+#define MACRO_REG(r) ((struct riscv_macro_operand) { true, (r) })
+#define MACRO_IMM(v) ((struct riscv_macro_operand) { false, (v) })
+
+/* Try to encode the NOPS operands in OPS as instruction INSN, the same way
+   riscv_ip would for the equivalent text.  Return false if they do not
+   fit this variant.  */
+
+static bool
+macro_match_operands (struct riscv_cl_insn *ip,
+		      const struct riscv_opcode *insn,
+		      const struct riscv_macro_operand *ops, int nops,
+		      expressionS *imm_expr,
+		      bfd_reloc_code_real_type *imm_reloc)
+{
+  const char *oparg;
+  int argnum = 0;
+
+  create_insn (ip, insn);
+  imm_expr->X_op = O_absent;
+  *imm_reloc = BFD_RELOC_UNUSED;
+
+  for (oparg = insn->args; *oparg != '\0'; ++oparg)
+    {
+      const struct riscv_macro_operand *op;
+      offsetT imm;
+      unsigned int regno;
+
+      if (*oparg == ',')
+	continue;
+      if (argnum == nops)
+	return false;
+      op = &ops[argnum++];
+      regno = op->value;
+      imm = op->value;
+
+      /* Registers and constants are never interchangeable.  */
+      if (op->reg != (strchr ("dst", *oparg) != NULL
+		      || (*oparg == 'C' && strchr ("swtxUVcz", oparg[1]))))
+	return false;
+
+      switch (*oparg)
+	{
+	case 'd':
+	  INSERT_OPERAND (RD, *ip, regno);
+	  continue;
+	case 's':
+	  INSERT_OPERAND (RS1, *ip, regno);
+	  continue;
+	case 't':
+	  INSERT_OPERAND (RS2, *ip, regno);
+	  continue;
+
+	case 'j': /* Sign-extended immediate.  */
+	  imm_expr->X_op = O_constant;
+	  imm_expr->X_add_number = imm;
+	  normalize_constant_expr (imm_expr);
+	  if (imm_expr->X_add_number >= (signed) RISCV_IMM_REACH / 2
+	      || imm_expr->X_add_number < -(signed) RISCV_IMM_REACH / 2)
+	    return false;
+	  *imm_reloc = BFD_RELOC_RISCV_LO12_I;
+	  continue;
+
+	case 'u': /* Upper 20 bits.  */
+	  if (imm < 0 || imm >= (signed) RISCV_BIGIMM_REACH)
+	    as_bad (_("lui expression not in range 0..1048575"));
+	  imm_expr->X_op = O_constant;
+	  imm_expr->X_add_number = imm << RISCV_IMM_BITS;
+	  *imm_reloc = BFD_RELOC_RISCV_HI20;
+	  continue;
+
+	case '>': /* Shift amount, 0 - (XLEN-1).  */
+	  if ((unsigned long) imm >= xlen)
+	    as_bad (_("improper shift amount (%lu)"), (unsigned long) imm);
+	  INSERT_OPERAND (SHAMT, *ip, imm);
+	  continue;
+
+	case 'z':
+	  if (imm != 0)
+	    return false;
+	  continue;
+
+	case 'C': /* RVC */
+	  switch (*++oparg)
+	    {
+	    case 's': /* RS1 x8-x15.  */
+	      if (!(regno >= 8 && regno <= 15))
+		return false;
+	      INSERT_OPERAND (CRS1S, *ip, regno % 8);
+	      continue;
+	    case 'w': /* RS1 x8-x15, constrained to equal RD x8-x15.  */
+	      if (EXTRACT_OPERAND (CRS1S, ip->insn_opcode) + 8 != regno)
+		return false;
+	      continue;
+	    case 't': /* RS2 x8-x15.  */
+	      if (!(regno >= 8 && regno <= 15))
+		return false;
+	      INSERT_OPERAND (CRS2S, *ip, regno % 8);
+	      continue;
+	    case 'x': /* RS2 x8-x15, constrained to equal RD x8-x15.  */
+	      if (EXTRACT_OPERAND (CRS2S, ip->insn_opcode) + 8 != regno)
+		return false;
+	      continue;
+	    case 'U': /* RS1, constrained to equal RD.  */
+	      if (EXTRACT_OPERAND (RD, ip->insn_opcode) != regno)
+		return false;
+	      continue;
+	    case 'V': /* RS2 */
+	      INSERT_OPERAND (CRS2, *ip, regno);
+	      continue;
+	    case 'c': /* RS1, constrained to equal sp.  */
+	      if (regno != X_SP)
+		return false;
+	      continue;
+	    case 'z': /* RS2, constrained to equal x0.  */
+	      if (regno != 0)
+		return false;
+	      continue;
+	    case '>': /* Shift amount, 0 - (XLEN-1).  */
+	      if ((unsigned long) imm >= xlen)
+		return false;
+	      ip->insn_opcode |= ENCODE_CITYPE_IMM (imm);
+	      continue;
+	    case 'j':
+	      if (imm == 0 || !VALID_CITYPE_IMM ((valueT) imm))
+		return false;
+	      ip->insn_opcode |= ENCODE_CITYPE_IMM (imm);
+	      continue;
+	    case 'o':
+	      if (!VALID_CITYPE_IMM ((valueT) imm))
+		return false;
+	      ip->insn_opcode |= ENCODE_CITYPE_IMM (imm);
+	      continue;
+	    case 'K':
+	      if (imm == 0 || !VALID_CIWTYPE_ADDI4SPN_IMM ((valueT) imm))
+		return false;
+	      ip->insn_opcode |= ENCODE_CIWTYPE_ADDI4SPN_IMM (imm);
+	      continue;
+	    case 'L':
+	      if (!VALID_CITYPE_ADDI16SP_IMM ((valueT) imm))
+		return false;
+	      ip->insn_opcode |= ENCODE_CITYPE_ADDI16SP_IMM (imm);
+	      continue;
+	    case 'v':
+	      if ((imm & (RISCV_IMM_REACH - 1)) || (int32_t) imm != imm)
+		return false;
+	      imm = ((uint32_t) imm) >> RISCV_IMM_BITS;
+	      /* Fall through.  */
+	    case 'u':
+	      if (imm <= 0
+		  || imm >= RISCV_BIGIMM_REACH
+		  || (imm >= RISCV_RVC_IMM_REACH / 2
+		      && imm < RISCV_BIGIMM_REACH - RISCV_RVC_IMM_REACH / 2))
+		return false;
+	      ip->insn_opcode |= ENCODE_CITYPE_IMM (imm);
+	      continue;
+	    default:
+	      break;
+	    }
+	  /* Fall through.  */
+	default:
+	  as_fatal (_("internal: unsupported macro operand `%s' of `%s'"),
+		    oparg, insn->name);
+	}
+    }
+
+  if (argnum != nops || !insn->match_func (insn, ip->insn_opcode))
+    return false;
+
+  return riscv_insn_length (insn->match) != 2 || riscv_opts.rvc;
+}
+
+/* Build an instruction created by a macro expansion from its NOPS operands,
+   given as struct riscv_macro_operand arguments in assembly order.  The
+   variant of NAME is chosen as md_assemble would choose it, including the
+   compressed ones, but without printing and re-parsing the text.  */
+
+static void
+macro_assemble (const char *name, int nops, ...)
+{
+  struct riscv_macro_operand ops[3];
+  const struct riscv_opcode *insn;
+  struct riscv_cl_insn ip;
+  expressionS imm_expr;
+  bfd_reloc_code_real_type imm_reloc;
+  va_list args;
+  int i;
+
+  gas_assert (nops <= (int) ARRAY_SIZE (ops));
+  va_start (args, nops);
+  for (i = 0; i < nops; i++)
+    ops[i] = va_arg (args, struct riscv_macro_operand);
+  va_end (args);
+
+  ip.cmodel.method = METHOD_DEFAULT;
+  nsta.ict_exp = NULL;
+
+  /* { Andes */
+  if (!frag_now->tc_frag_data.rvc)
+    frag_now->tc_frag_data.rvc = riscv_opts.rvc ? 1 : -1;
+  /* } Andes */
+
+  insn = (struct riscv_opcode *) str_hash_find (op_hash, name);
+  gas_assert (insn);
+  for (; insn->name && strcmp (insn->name, name) == 0; insn++)
+    {
+      if ((insn->xlen_requirement != 0) && (xlen != insn->xlen_requirement))
+	continue;
+
+      if (!riscv_multi_subset_supports (&riscv_rps_as, insn->insn_class))
+	continue;
+
+      /* VLSI mode desires AS IT conversion.  */
+      if (riscv_opts.no_rvc_convert
+	  && (insn->insn_class == INSN_CLASS_C
+	      || insn->insn_class == INSN_CLASS_F_AND_C
+	      || insn->insn_class == INSN_CLASS_D_AND_C)
+	  && 0 != strncmp (insn->name, "c.", 2))
+	continue;
+
+      if (macro_match_operands (&ip, insn, ops, nops, &imm_expr, &imm_reloc))
+	{
+	  riscv_append_insn (&ip, &imm_expr, imm_reloc);
+	  return;
+	}
+    }
+
+  as_bad (_("illegal operands `%s'"), name);
+}
+
 static symbolS *
 make_internal_label (void)
 {
@@ -2776,10 +2976,11 @@ load_const (int reg, expressionS *ep)
       upper.X_add_number = (int64_t) upper.X_add_number >> shift;
       load_const (reg, &upper);
 
-      md_assemblef ("slli x%d, x%d, 0x%x", reg, reg, shift);
+      macro_assemble ("slli", 3, MACRO_REG (reg), MACRO_REG (reg),
+		      MACRO_IMM (shift));
       if (lower.X_add_number != 0)
-	md_assemblef ("addi x%d, x%d, %" BFD_VMA_FMT "d", reg, reg,
-		      lower.X_add_number);
+	macro_assemble ("addi", 3, MACRO_REG (reg), MACRO_REG (reg),
+			MACRO_IMM (lower.X_add_number));
     }
   else
     {
@@ -2791,13 +2992,13 @@ load_const (int reg, expressionS *ep)
 	  /* Discard low part and zero-extend upper immediate.  */
 	  upper_imm = ((uint32_t)upper.X_add_number >> shift);
 
-	  md_assemblef ("lui x%d, 0x%" BFD_VMA_FMT "x", reg, upper_imm);
+	  macro_assemble ("lui", 2, MACRO_REG (reg), MACRO_IMM (upper_imm));
 	  hi_reg = reg;
 	}
 
       if (lower.X_add_number != 0 || hi_reg == 0)
-	md_assemblef ("%s x%d, x%d, %" BFD_VMA_FMT "d", ADD32_INSN, reg, hi_reg,
-		      lower.X_add_number);
+	macro_assemble (ADD32_INSN, 3, MACRO_REG (reg), MACRO_REG (hi_reg),
+			MACRO_IMM (lower.X_add_number));
     }
 }
 
@@ -2806,16 +3007,10 @@ load_const (int reg, expressionS *ep)
 static void
 riscv_ext (int destreg, int srcreg, unsigned shift, bool sign)
 {
-  if (sign)
-    {
-      md_assemblef ("slli x%d, x%d, 0x%x", destreg, srcreg, shift);
-      md_assemblef ("srai x%d, x%d, 0x%x", destreg, destreg, shift);
-    }
-  else
-    {
-      md_assemblef ("slli x%d, x%d, 0x%x", destreg, srcreg, shift);
-      md_assemblef ("srli x%d, x%d, 0x%x", destreg, destreg, shift);
-    }
+  macro_assemble ("slli", 3, MACRO_REG (destreg), MACRO_REG (srcreg),
+		  MACRO_IMM (shift));
+  macro_assemble (sign ? "srai" : "srli", 3, MACRO_REG (destreg),
+		  MACRO_REG (destreg), MACRO_IMM (shift));
 }
 
 /* Expand RISC-V Vector macros into one or more instructions.  */
@@ -6154,6 +6349,28 @@ riscv_relax_frag (asection *sec, fragS *fragp, long stretch ATTRIBUTE_UNUSED)
   return 0;
 }
 
+/* Implement md_relax_frag_symbol.  Branches depend at most on the
+   distance to their target; the CModel sequences are sized once by
+   md_estimate_size_before_relax.  */
+
+int
+riscv_relax_frag_symbol (asection *sec, fragS *fragp, symbolS **symp)
+{
+  *symp = NULL;
+  if (RELAX_BRANCH_P (fragp->fr_subtype))
+    {
+      if (!riscv_opts.no_branch_relax
+	  && fragp->fr_symbol != NULL
+	  && S_IS_DEFINED (fragp->fr_symbol)
+	  && !S_IS_WEAK (fragp->fr_symbol)
+	  && sec == S_GET_SEGMENT (fragp->fr_symbol))
+	*symp = fragp->fr_symbol;
+      return 1;
+    }
+
+  return RELAX_CMODEL_P (fragp->fr_subtype);
+}
+
 /* Expand far branches to multi-instruction sequences.  */
 
 static void
@@ -7740,57 +7957,10 @@ andes_insert_btb_reloc (struct riscv_cl_insn *ip)
 
 /* { Andes ACE */
 static void
-ace_encode_insn (unsigned int v, ace_op_t * ace_op, struct riscv_cl_insn *ip)
+ace_encode_insn (unsigned int v, const ace_field_t *field,
+		 struct riscv_cl_insn *ip)
 {
-  unsigned int bit_value = v;
-
-  /* Perform mask to truncate oversize value */
-  bit_value <<= 32 - ace_op->bitsize;
-  bit_value >>= 32 - ace_op->bitsize;
-
-  /* Shift value to specified position */
-  bit_value <<= ace_op->bitpos - ace_op->bitsize + 1;
-
-  ip->insn_opcode = (unsigned int) ip->insn_opcode | bit_value;
-}
-
-static void
-ace_encode_insn_discrete (unsigned int v, char *op_name_discrete, const char *op, struct riscv_cl_insn *ip)
-{
-  bfd_boolean found_or_token = TRUE;
-  unsigned bit_value = 0;
-  char *psep, *pval = op_name_discrete + strlen(op);
-  unsigned msb = 0, width = 0, width_acc = 0;
-
-  while (found_or_token) {
-	/* Extract msb from string */
-	psep = strchr (pval, '_');
-	*psep = '\0';
-	msb = strtoul (pval, (char **) NULL, 10);
-	/* Extract width from string */
-	pval = psep + 1;
-	psep = strchr (pval, '|');
-	if (psep)
-	  *psep = '\0';
-	else
-	  found_or_token = FALSE;
-	width = strtoul (pval, (char **) NULL, 10);
-
-	/* Perform mask to truncate oversize value */
-	bit_value = v >> width_acc;
-	bit_value <<= 32 - width;
-	bit_value >>= 32 - width;
-
-	/* Shift value to specified position */
-	bit_value <<= msb - width + 1;
-
-	ip->insn_opcode = (unsigned int) ip->insn_opcode | bit_value;
-	width_acc += width;
-
-	/* Prepare condition for next iteration */
-	pval = psep + 1;
-  }
-
+  ip->insn_opcode |= (unsigned int) andes_ace_insert (field, v);
 }
 
 /* Assemble ACE instruction string to binary */
@@ -7798,45 +7968,18 @@ ace_encode_insn_discrete (unsigned int v, char *op_name_discrete, const char *op
 static void
 ace_ip (char **args, char **str, struct riscv_cl_insn *ip)
 {
-  /* Extract field attribute name from opcode description (ace_ops) and
-     store the extracted result to var of op_name for finding the
-     field attribute information from ace_op_hash */
-  bfd_boolean found_op_str_end = FALSE;
-  char *pch = strchr (*args, ',');
-  if (pch == NULL)
-    {
-      pch = strchr (*args, '\0');
-      found_op_str_end = TRUE;
-    }
-  if (pch == NULL)
-    as_fatal (_("Broken assembler.  No assembly attempted."));
-
-  unsigned int op_name_size = pch - (*args + 1);
-  char *op_name = malloc (op_name_size + 1);
-  memcpy (op_name, *args + 1, op_name_size);
-  /* Cat null character to the end of op_name to avoid gash */
-  memcpy (op_name + op_name_size, "\0", 1);
+  /* The field attribute was compiled from the opcode description
+     (ace_ops) when the ACE library was loaded.  */
+  const ace_field_t *field = andes_ace_field (*args);
+  if (field == NULL || field->op == NULL)
+    as_fatal (_("Broken assembler.  Cannot find field attribute."));
+  const ace_op_t *ace_op = field->op;
 
   /* Check whether encounter the end of line in assembly code */
   bfd_boolean found_asm_end = FALSE;
   if (strchr (*str, ',') == NULL && strchr (*str, '\0') != NULL)
     found_asm_end = TRUE;
 
-  /* With rGPR encoding format, operand bit-field may be discrete.
-     There is an "|" token in discrete format */
-  bfd_boolean is_discrete = FALSE;
-  char *por = strchr (op_name, '|');
-  char *op_name_discrete = NULL;
-  if (por != NULL)
-    {
-      is_discrete = TRUE;
-      op_name_discrete = malloc (op_name_size + 1);
-      strcpy (op_name_discrete, op_name);
-      *por = '\0';
-    }
-
-  /*  Find the field attribute from ace_op_hash and encode instruction */
-  ace_op_t *ace_op = (ace_op_t *) str_hash_find (ace_op_hash, op_name);
   switch (ace_op->hw_res)
     {
     case HW_GPR:
@@ -7845,7 +7988,7 @@ ace_ip (char **args, char **str, struct riscv_cl_insn *ip)
 	  /* Extract the GPR index string from assembly code (*str) */
 	  if (reg_lookup (str, RCLASS_GPR, &regno))
 	    /* Encode instruction */
-	    ace_encode_insn (regno, ace_op, ip);
+	    ace_encode_insn (regno, field, ip);
 
 	  /* Update the address of pointer of assembly code (*str) */
 	  if (!found_asm_end)
@@ -7859,7 +8002,7 @@ ace_ip (char **args, char **str, struct riscv_cl_insn *ip)
 	  /* Extract the FPR index string from assembly code (*str) */
 	  if (reg_lookup (str, RCLASS_FPR, &regno))
 	    /* Encode instruction */
-	    ace_encode_insn (regno, ace_op, ip);
+	    ace_encode_insn (regno, field, ip);
 
 	  /* Update the address of pointer of assembly code (*str) */
 	  if (!found_asm_end)
@@ -7873,7 +8016,7 @@ ace_ip (char **args, char **str, struct riscv_cl_insn *ip)
 	  /* Extract the VR index string from assembly code (*str) */
 	  if (reg_lookup (str, RCLASS_VECR, &regno))
 	    /* Encode instruction */
-	    ace_encode_insn (regno, ace_op, ip);
+	    ace_encode_insn (regno, field, ip);
 
 	  /* Update the address of pointer of assembly code (*str) */
 	  if (!found_asm_end)
@@ -7890,16 +8033,10 @@ ace_ip (char **args, char **str, struct riscv_cl_insn *ip)
 	  if (p == NULL)
 	    as_fatal (_("Broken assembler.  No IMM value is given."));
 	  unsigned int imm_size = p - *str;
-	  char *imm = malloc (imm_size + 1);
-	  memcpy (imm, *str, imm_size);
-	  memcpy (imm + imm_size, "\0", 1);
-	  unsigned int imm_value = strtoul (imm, (char **) NULL, 0);
+	  unsigned int imm_value = strtoul (*str, (char **) NULL, 0);
 
 	  /* Encode instruction */
-	  if (is_discrete)
-	    ace_encode_insn_discrete (imm_value, op_name_discrete, "imm",  ip);
-	  else
-	    ace_encode_insn (imm_value, ace_op, ip);
+	  ace_encode_insn (imm_value, field, ip);
 
 	  /* Update the address of pointer of assembly code (*str) */
 	  if (found_asm_end)
@@ -7918,22 +8055,17 @@ ace_ip (char **args, char **str, struct riscv_cl_insn *ip)
 	  if (p == NULL)
 	    as_fatal (_("No ACR register index is given."));
 	  unsigned int reg_idx_size = p - *str;
-	  char *reg_idx = malloc (reg_idx_size + 1);
-	  memcpy (reg_idx, *str, reg_idx_size);
-	  // always append EOL at ACR index string
-	  memcpy (reg_idx + reg_idx_size, "\0", 1);
+	  char *reg_idx = xmemdup0 (*str, reg_idx_size);
 
 	  /* Find the digit number of ACR register index string */
 	  ace_keyword_t *ace_reg =
 	    (ace_keyword_t *) str_hash_find (ace_keyword_hash, reg_idx);
 	  if (ace_reg != NULL)
 	    /* Encode instruction */
-	    if (is_discrete)
-	      ace_encode_insn_discrete (ace_reg->value, op_name_discrete, ace_op->hw_name,  ip);
-	    else
-	      ace_encode_insn (ace_reg->value, ace_op, ip);
+	    ace_encode_insn (ace_reg->value, field, ip);
 	  else
 	    as_fatal (_("Wrong ACR register index (%s)) is given."), reg_idx);
+	  free (reg_idx);
 
 	  /* Update the address of pointer of assembly code (*str) */
 	  if (found_asm_end)
@@ -7948,9 +8080,9 @@ ace_ip (char **args, char **str, struct riscv_cl_insn *ip)
     }
 
   /* Update the address of pointer of the field attribute (*args) */
-  if (found_op_str_end == TRUE)
-    *args = pch - 1;
+  if (*field->end == '\0')
+    *args = (char *) field->end - 1;
   else
-    *args = pch;
+    *args = (char *) field->end;
 }
 /* } Andes ACE */
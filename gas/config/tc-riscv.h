@@ -49,6 +49,11 @@ struct expressionS;
   riscv_relax_frag (segment, fragp, stretch)
 extern int riscv_relax_frag (asection *, struct frag *, long);
 
+#define md_relax_frag_symbol(segment, fragp, symp) \
+  riscv_relax_frag_symbol (segment, fragp, symp)
+extern int riscv_relax_frag_symbol (asection *, struct frag *,
+				    symbolS **);
+
 #define md_section_align(seg,size)	(size)
 #define md_undefined_symbol(name)	(0)
 #define md_operand(x)
@@ -0,0 +1,11 @@
+	# Strings of pseudo-random letters, which zlib compresses to
+	# different sizes at its fastest and at its best level.
+	.section .debug_str,"MS",%progbits,1
+	.set	seed, 1
+	.rept	64
+	.rept	15
+	.set	seed, (seed * 75 + 74) % 65537
+	.byte	'a' + (seed >> 4) % 6
+	.endr
+	.byte	0
+	.endr
@@ -0,0 +1,5 @@
+target:
+	# Reserved RVC encodings must not match the vmsge macros.
+	.insn	0x6481
+	.insn	0x9e41
+	vmsge.vx v4, v8, a1
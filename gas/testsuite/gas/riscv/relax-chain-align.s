@@ -0,0 +1,28 @@
+	# Each branch reaches its target until the branch after it grows,
+	# so the growth ripples back one branch at a time, through an
+	# alignment frag whose padding changes as it goes, and needs more
+	# passes than gas makes over the whole section.
+	.option norvc
+	.text
+	.altmacro
+	.macro	branch k
+	beq	a0, a1, t\k
+	.endm
+	.macro	target k
+t\k:
+	nop
+	nop
+	.endm
+
+	.set	k, 1
+	.rept	12
+	branch	%k
+	.set	k, k + 1
+	.endr
+	.balign	16
+	.space	3992
+	.set	k, 1
+	.rept	12
+	target	%k
+	.set	k, k + 1
+	.endr
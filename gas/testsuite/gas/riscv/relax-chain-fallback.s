@@ -0,0 +1,28 @@
+	# Each branch reaches its target until the branch after it grows,
+	# so the growth ripples back one branch at a time and needs more
+	# passes than gas makes over the whole section.  The chain is
+	# also long enough that gas gives up following the dependencies
+	# and falls back to relaxing the whole section again.
+	.option norvc
+	.text
+	.altmacro
+	.macro	branch k
+	beq	a0, a1, t\k
+	.endm
+	.macro	target k
+t\k:
+	nop
+	nop
+	.endm
+
+	.set	k, 1
+	.rept	64
+	branch	%k
+	.set	k, k + 1
+	.endr
+	.space	3588
+	.set	k, 1
+	.rept	64
+	target	%k
+	.set	k, k + 1
+	.endr
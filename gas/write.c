@@ -1485,7 +1485,7 @@ compress_debug (bfd *abfd, asection *sec, void *xxx ATTRIBUTE_UNUSED)
   if (!startswith (section_name, ".debug_"))
     return;
 
-  strm = compress_init ();
+  strm = compress_init (flag_compress_debug_level);
   if (strm == NULL)
     return;
 
@@ -2682,6 +2682,401 @@ relax_align (relax_addressT address,	/* Address now.  */
   return (new_address - address);
 }
 
+#ifdef md_relax_frag_symbol
+/* Dependency tracking relaxation.  Instead of re-walking every frag of
+   the segment until nothing changes, record for each relaxable frag the
+   range of frags whose sizes it depends on, and re-evaluate only the
+   frags whose range covers a frag that has just changed size.  This is
+   only done when every frag of the segment is a fill, an alignment, or
+   a machine dependent frag whose size depends at most on the distance
+   to a label, as told by md_relax_frag_symbol.  */
+
+struct relax_deps
+{
+  /* The frags of the segment, in order.  */
+  unsigned long count;
+  fragS **frags;
+
+  /* The address of each frag before relaxation, its current size, and a
+     Fenwick tree of the growth of the frags since.  */
+  addressT *base;
+  offsetT *size;
+  offsetT *growth;
+
+  /* For the frags that need to be relaxed, the frag whose address they
+     depend on, if any.  */
+  unsigned long *target;
+
+  /* An interval tree over the frags, with WIDTH leaves.  USERS lists
+     from START[N] to START[N + 1] the frags depending on all the frags
+     under node N.  */
+  unsigned long width;
+  unsigned long *start;
+  unsigned long *users;
+
+  /* The frags to re-evaluate, as a min-heap by index.  */
+  unsigned long *heap;
+  unsigned long heap_count;
+  bool *queued;
+};
+
+static hashval_t
+relax_frag_hash (const void *entry)
+{
+  return htab_hash_pointer (*(fragS * const *) entry);
+}
+
+static int
+relax_frag_eq (const void *entry1, const void *entry2)
+{
+  return *(fragS * const *) entry1 == *(fragS * const *) entry2;
+}
+
+/* Return the sum of the growth of the frags before frag I.  */
+
+static offsetT
+relax_deps_growth (struct relax_deps *deps, unsigned long i)
+{
+  offsetT sum = 0;
+
+  for (; i > 0; i -= i & -i)
+    sum += deps->growth[i];
+  return sum;
+}
+
+static void
+relax_deps_grow (struct relax_deps *deps, unsigned long i, offsetT growth)
+{
+  deps->size[i] += growth;
+  for (i++; i <= deps->count; i += i & -i)
+    deps->growth[i] += growth;
+}
+
+static void
+relax_deps_push (struct relax_deps *deps, unsigned long i)
+{
+  unsigned long n = deps->heap_count++;
+
+  deps->queued[i] = true;
+  while (n > 0 && deps->heap[(n - 1) / 2] > i)
+    {
+      deps->heap[n] = deps->heap[(n - 1) / 2];
+      n = (n - 1) / 2;
+    }
+  deps->heap[n] = i;
+}
+
+static unsigned long
+relax_deps_pop (struct relax_deps *deps)
+{
+  unsigned long i = deps->heap[0];
+  unsigned long last = deps->heap[--deps->heap_count];
+  unsigned long n = 0;
+
+  for (;;)
+    {
+      unsigned long c = 2 * n + 1;
+      if (c >= deps->heap_count)
+	break;
+      if (c + 1 < deps->heap_count && deps->heap[c + 1] < deps->heap[c])
+	c++;
+      if (deps->heap[c] >= last)
+	break;
+      deps->heap[n] = deps->heap[c];
+      n = c;
+    }
+  deps->heap[n] = last;
+  deps->queued[i] = false;
+  return i;
+}
+
+/* Call FUNC on each node of the interval tree covering the frags from
+   LO to HI, excluded.  */
+
+static void
+relax_deps_cover (struct relax_deps *deps, unsigned long lo,
+		  unsigned long hi, unsigned long user,
+		  void (*func) (struct relax_deps *, unsigned long,
+				unsigned long))
+{
+  for (lo += deps->width, hi += deps->width; lo < hi; lo /= 2, hi /= 2)
+    {
+      if (lo & 1)
+	func (deps, lo++, user);
+      if (hi & 1)
+	func (deps, --hi, user);
+    }
+}
+
+static void
+relax_deps_count_user (struct relax_deps *deps, unsigned long node,
+		       unsigned long user ATTRIBUTE_UNUSED)
+{
+  deps->start[node + 1]++;
+}
+
+static void
+relax_deps_add_user (struct relax_deps *deps, unsigned long node,
+		     unsigned long user)
+{
+  deps->users[deps->start[node]++] = user;
+}
+
+/* Return the range of frags, from *LO to *HI excluded, whose sizes frag
+   I depends on.  */
+
+static void
+relax_deps_range (struct relax_deps *deps, unsigned long i,
+		  unsigned long *lo, unsigned long *hi)
+{
+  unsigned long t = deps->target[i];
+
+  if (deps->frags[i]->fr_type != rs_machine_dependent)
+    {
+      /* An alignment depends on its own address.  */
+      *lo = 0;
+      *hi = i;
+    }
+  else if (t == deps->count)
+    *lo = *hi = i;
+  else if (t > i)
+    {
+      /* A forward reference also depends on the frag's own variable
+	 part.  */
+      *lo = i;
+      *hi = t;
+    }
+  else
+    {
+      *lo = t;
+      *hi = i;
+    }
+}
+
+static void
+relax_deps_free (struct relax_deps *deps)
+{
+  free (deps->frags);
+  free (deps->base);
+  free (deps->size);
+  free (deps->growth);
+  free (deps->target);
+  free (deps->start);
+  free (deps->users);
+  free (deps->heap);
+  free (deps->queued);
+}
+
+/* Set up DEPS for the COUNT frags from SEGMENT_FRAG_ROOT, whose
+   addresses must match their current sizes.  Return false if a frag of
+   the segment can not be tracked.  */
+
+static bool
+relax_deps_init (struct relax_deps *deps, struct frag *segment_frag_root,
+		 segT segment, unsigned long count)
+{
+  fragS *fragP;
+  htab_t index;
+  unsigned long i, n, nusers;
+  bool ok = true;
+
+  memset (deps, 0, sizeof (*deps));
+  deps->count = count;
+  deps->frags = XNEWVEC (fragS *, count);
+  deps->target = XNEWVEC (unsigned long, count);
+  index = htab_create_alloc (count, relax_frag_hash, relax_frag_eq,
+			     NULL, xcalloc, free);
+  for (i = 0, fragP = segment_frag_root; fragP; fragP = fragP->fr_next, i++)
+    {
+      deps->frags[i] = fragP;
+      *htab_find_slot (index, &deps->frags[i], INSERT) = &deps->frags[i];
+    }
+
+  /* The size of the last frag is only known for a fill.  */
+  if (count == 0 || deps->frags[count - 1]->fr_type != rs_fill)
+    ok = false;
+  for (i = 0; i < count && ok; i++)
+    {
+      symbolS *symbolP = NULL;
+      fragS **slot;
+
+      fragP = deps->frags[i];
+      deps->target[i] = count;
+      switch (fragP->fr_type)
+	{
+	case rs_fill:
+	case rs_align:
+	case rs_align_code:
+	case rs_align_test:
+	  break;
+
+	case rs_machine_dependent:
+	  if (!md_relax_frag_symbol (segment, fragP, &symbolP))
+	    ok = false;
+	  else if (symbolP == NULL)
+	    break;
+	  else if (!symbol_constant_p (symbolP)
+		   || S_GET_SEGMENT (symbolP) != segment)
+	    ok = false;
+	  else
+	    {
+	      fragS *sym_frag = symbol_get_frag (symbolP);
+	      slot = htab_find (index, &sym_frag);
+	      if (slot == NULL)
+		ok = false;
+	      else
+		deps->target[i] = slot - deps->frags;
+	    }
+	  break;
+
+	default:
+	  ok = false;
+	  break;
+	}
+    }
+  htab_delete (index);
+  if (!ok)
+    {
+      relax_deps_free (deps);
+      return false;
+    }
+
+  deps->base = XNEWVEC (addressT, count);
+  deps->size = XNEWVEC (offsetT, count);
+  deps->growth = XCNEWVEC (offsetT, count + 1);
+  for (i = 0; i < count; i++)
+    {
+      addressT next;
+
+      fragP = deps->frags[i];
+      if (fragP->fr_next != NULL)
+	next = fragP->fr_next->fr_address;
+      else
+	next = (fragP->fr_address + fragP->fr_fix
+		+ fragP->fr_offset * fragP->fr_var);
+      deps->base[i] = deps->frags[i]->fr_address;
+      deps->size[i] = next - deps->base[i];
+    }
+
+  /* Build the interval tree, counting the users of each node first.  */
+  for (deps->width = 1; deps->width < count; deps->width *= 2)
+    ;
+  deps->start = XCNEWVEC (unsigned long, 2 * deps->width + 1);
+  for (i = 0; i < count; i++)
+    if (deps->frags[i]->fr_type != rs_fill)
+      {
+	unsigned long lo, hi;
+	relax_deps_range (deps, i, &lo, &hi);
+	relax_deps_cover (deps, lo, hi, i, relax_deps_count_user);
+      }
+  for (n = 0, nusers = 0; n < 2 * deps->width; n++)
+    {
+      nusers += deps->start[n + 1];
+      deps->start[n + 1] = nusers;
+    }
+  deps->users = XNEWVEC (unsigned long, nusers);
+  for (i = 0; i < count; i++)
+    if (deps->frags[i]->fr_type != rs_fill)
+      {
+	unsigned long lo, hi;
+	relax_deps_range (deps, i, &lo, &hi);
+	relax_deps_cover (deps, lo, hi, i, relax_deps_add_user);
+      }
+  /* Filling advanced each START to the start of the next node.  */
+  memmove (deps->start + 1, deps->start, 2 * deps->width * sizeof (*deps->start));
+  deps->start[0] = 0;
+
+  /* Evaluate every relaxable frag at least once, in order.  */
+  deps->heap = XNEWVEC (unsigned long, count);
+  deps->queued = XCNEWVEC (bool, count);
+  for (i = 0; i < count; i++)
+    if (deps->frags[i]->fr_type != rs_fill)
+      {
+	deps->queued[i] = true;
+	deps->heap[deps->heap_count++] = i;
+      }
+  return true;
+}
+
+/* Relax the frags of SEGMENT with DEPS.  Return false if the frag sizes
+   did not settle within a small number of evaluations of each frag, in
+   which case the caller should fall back to relaxing the whole segment
+   over and over.  */
+
+static bool
+relax_deps_run (struct relax_deps *deps, segT segment)
+{
+  unsigned long limit = 16 * (deps->heap_count + 1);
+  unsigned long i;
+  addressT address;
+
+  while (deps->heap_count != 0 && limit-- != 0)
+    {
+      fragS *fragP;
+      offsetT growth;
+
+      i = relax_deps_pop (deps);
+      fragP = deps->frags[i];
+      fragP->fr_address = deps->base[i] + relax_deps_growth (deps, i);
+
+      if (fragP->fr_type == rs_machine_dependent)
+	{
+	  unsigned long t = deps->target[i];
+	  if (t != deps->count)
+	    deps->frags[t]->fr_address = (deps->base[t]
+					  + relax_deps_growth (deps, t));
+	  growth = md_relax_frag (segment, fragP, 0);
+	}
+      else
+	{
+	  addressT newoff = relax_align (fragP->fr_address + fragP->fr_fix,
+					 (int) fragP->fr_offset);
+	  if (fragP->fr_subtype != 0 && newoff > fragP->fr_subtype)
+	    newoff = 0;
+	  growth = newoff - (deps->size[i] - fragP->fr_fix);
+	}
+
+      if (growth != 0)
+	{
+	  unsigned long node;
+
+	  relax_deps_grow (deps, i, growth);
+	  for (node = i + deps->width; node != 0; node /= 2)
+	    {
+	      unsigned long u;
+	      for (u = deps->start[node]; u < deps->start[node + 1]; u++)
+		if (!deps->queued[deps->users[u]])
+		  relax_deps_push (deps, deps->users[u]);
+	    }
+	}
+    }
+
+  for (i = 0, address = 0; i < deps->count; i++)
+    {
+      deps->frags[i]->fr_address = address;
+      address += deps->size[i];
+    }
+  return deps->heap_count == 0;
+}
+
+/* Relax the COUNT frags of SEGMENT from SEGMENT_FRAG_ROOT by tracking
+   their dependencies.  Return true if they are now relaxed.  */
+
+static bool
+relax_segment_deps (struct frag *segment_frag_root, segT segment,
+		    unsigned long count)
+{
+  struct relax_deps deps;
+  bool done;
+
+  if (!relax_deps_init (&deps, segment_frag_root, segment, count))
+    return false;
+  done = relax_deps_run (&deps, segment);
+  relax_deps_free (&deps);
+  return done;
+}
+#endif /* md_relax_frag_symbol  */
+
 /* Now we have a segment, not a crowd of sub-segments, we can make
    fr_address values.
 
@@ -2830,6 +3225,13 @@ relax_segment (struct frag *segment_frag_root, segT segment, int pass)
        relax.  */
     int rs_leb128_fudge = 0;
 
+#ifdef md_relax_frag_symbol
+    /* Passes after which to switch to dependency tracking.  Most
+       segments settle in a couple of passes, for which a plain walk
+       over the frags is cheapest.  */
+    int deps_passes = 4;
+#endif
+
     /* We want to prevent going into an infinite loop where one frag grows
        depending upon the location of a symbol which is in turn moved by
        the growing frag.  eg:
@@ -3156,6 +3558,13 @@ relax_segment (struct frag *segment_frag_root, segT segment, int pass)
 	  rs_leb128_fudge += 1;
 	else
 	  rs_leb128_fudge = 0;
+
+#ifdef md_relax_frag_symbol
+	if (stretched
+	    && --deps_passes == 0
+	    && relax_segment_deps (segment_frag_root, segment, frag_count))
+	  stretched = 0;
+#endif
       }
     /* Until nothing further to relax.  */
     while (stretched && -- max_iterations);
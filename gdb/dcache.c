@@ -83,6 +83,15 @@ static unsigned dcache_size = DCACHE_DEFAULT_SIZE;
 #define DCACHE_DEFAULT_LINE_SIZE 64
 static unsigned dcache_line_size = DCACHE_DEFAULT_LINE_SIZE;
 
+/* The most lines a miss may read from the target at once.  When the
+   misses look like a sequential or strided walk through memory, the
+   lines the walk is expected to touch next are read along with the
+   one that missed, so that a long walk costs a few large reads
+   rather than one small read per line.  Values below 2 disable this
+   read-ahead.  */
+#define DCACHE_DEFAULT_READAHEAD 16
+static unsigned dcache_readahead = DCACHE_DEFAULT_READAHEAD;
+
 /* Each cache block holds LINE_SIZE bytes of data
    starting at a multiple-of-LINE_SIZE address.  */
 
@@ -98,6 +107,7 @@ struct dcache_block
 
   CORE_ADDR addr;		/* address of data */
   int refs;			/* # hits */
+  bool prefetched;		/* read ahead, not referenced yet */
   gdb_byte data[1];		/* line_size bytes at given address */
 };
 
@@ -120,6 +130,22 @@ struct dcache_struct
   /* The process target of last inferior to use the cache or
      nullptr.  */
   process_stratum_target *proc_target;
+
+  /* Read-ahead state.  LAST_MISS is the line that missed last, and
+     STRIDE its distance from the miss before.  WINDOW is the number
+     of lines of the walk that the last miss read, and NEXT_MISS the
+     line where the walk will miss again if it goes on.  */
+  CORE_ADDR last_miss;
+  LONGEST stride;
+  unsigned window;
+  CORE_ADDR next_miss;
+
+  /* Statistics for "info dcache".  These survive invalidation.  */
+  ULONGEST hits;
+  ULONGEST misses;
+  ULONGEST reads;
+  ULONGEST prefetched;
+  ULONGEST prefetch_hits;
 };
 
 typedef void (block_func) (struct dcache_block *block, void *param);
@@ -254,6 +280,10 @@ dcache_invalidate (DCACHE *dcache)
   dcache->size = 0;
   dcache->ptid = null_ptid;
   dcache->proc_target = nullptr;
+  dcache->last_miss = 0;
+  dcache->stride = 0;
+  dcache->window = 1;
+  dcache->next_miss = 0;
 
   if (dcache->line_size != dcache_line_size)
     {
@@ -338,6 +368,7 @@ dcache_read_line (DCACHE *dcache, struct dcache_block *db)
 	  continue;
 	}
 
+      dcache->reads++;
       res = target_read_raw_memory (memaddr, myaddr, reg_len);
       if (res != 0)
 	return 0;
@@ -381,6 +412,7 @@ dcache_alloc (DCACHE *dcache, CORE_ADDR addr)
 
   db->addr = MASK (dcache, addr);
   db->refs = 0;
+  db->prefetched = false;
 
   /* Put DB at the end of the list, it's the newest.  */
   append_block (&dcache->oldest, db);
@@ -391,28 +423,162 @@ dcache_alloc (DCACHE *dcache, CORE_ADDR addr)
   return db;
 }
 
-/* Using the data cache DCACHE, store in *PTR the contents of the byte at
-   address ADDR in the remote machine.  
-
-   Returns 1 for success, 0 for error.  */
+/* Read the lines of [LO, HI) from the target in one request and
+   store any of them not yet cached, DB among them.  DB must already
+   be allocated for its line.  Return 1 for success, 0 if the range
+   could not be read, in which case nothing is stored.  */
 
 static int
-dcache_peek_byte (DCACHE *dcache, CORE_ADDR addr, gdb_byte *ptr)
+dcache_read_ahead (DCACHE *dcache, struct dcache_block *db,
+		   CORE_ADDR lo, CORE_ADDR hi)
 {
-  struct dcache_block *db = dcache_hit (dcache, addr);
+  struct mem_region *region = lookup_mem_region (db->addr);
+  CORE_ADDR addr;
+
+  /* Stay within the memory region of the line that missed, so that
+     read-ahead never strays into memory with other attributes, such
+     as memory-mapped I/O.  */
+  if (region->attrib.mode == MEM_WO
+      || db->addr < region->lo
+      || (region->hi != 0 && db->addr + dcache->line_size > region->hi))
+    return 0;
+  if (lo < region->lo)
+    lo = MASK (dcache, region->lo + dcache->line_size - 1);
+  if (region->hi != 0 && hi > region->hi)
+    hi = MASK (dcache, region->hi);
+  if (hi - lo <= dcache->line_size)
+    return 0;
 
-  if (!db)
+  gdb::byte_vector buf (hi - lo);
+
+  dcache->reads++;
+  if (target_read_raw_memory (lo, buf.data (), hi - lo) != 0)
+    return 0;
+
+  for (addr = lo; addr < hi; addr += dcache->line_size)
     {
-      db = dcache_alloc (dcache, addr);
+      struct dcache_block *line = db;
 
-      if (!dcache_read_line (dcache, db))
-	 return 0;
+      if (addr != db->addr)
+	{
+	  if (splay_tree_lookup (dcache->tree, (splay_tree_key) addr))
+	    continue;
+	  line = dcache_alloc (dcache, addr);
+	  line->prefetched = true;
+	  dcache->prefetched++;
+	}
+      memcpy (line->data, buf.data () + (addr - lo), dcache->line_size);
     }
 
-  *ptr = db->data[XFORM (dcache, addr)];
   return 1;
 }
 
+/* Allocate and fill the line containing ADDR, which was not in
+   DCACHE.  If the misses so far form a sequential or strided walk,
+   read the lines the walk should touch next in the same request,
+   reading twice as many each time the walk misses where expected.
+   Return the line, or NULL if it could not be read.  */
+
+static struct dcache_block *
+dcache_miss (DCACHE *dcache, CORE_ADDR addr)
+{
+  CORE_ADDR line = MASK (dcache, addr);
+  LONGEST delta = (LONGEST) (line - dcache->last_miss);
+  ULONGEST max_span;
+  ULONGEST abs_stride;
+  struct dcache_block *db;
+
+  dcache->misses++;
+
+  if (dcache->stride != 0 && line == dcache->next_miss)
+    dcache->window *= 2;
+  else if (dcache->stride != 0 && delta == dcache->stride)
+    dcache->window = 2;
+  else
+    {
+      dcache->stride = delta;
+      dcache->window = 1;
+    }
+
+  /* Read at most DCACHE_READAHEAD lines, and at most half the cache
+     so that reading ahead cannot evict the line that missed.  */
+  max_span = ((ULONGEST) std::min (dcache_readahead, dcache_size / 2)
+	      * dcache->line_size);
+  abs_stride = dcache->stride < 0 ? -dcache->stride : dcache->stride;
+  if (abs_stride == 0 || max_span < dcache->line_size + abs_stride)
+    dcache->window = 1;
+  else
+    dcache->window
+      = std::min ((ULONGEST) dcache->window,
+		  (max_span - dcache->line_size) / abs_stride + 1);
+
+  dcache->last_miss = line;
+  dcache->next_miss = line + dcache->window * dcache->stride;
+
+  db = dcache_alloc (dcache, line);
+
+  if (dcache->window > 1)
+    {
+      CORE_ADDR span = (dcache->window - 1) * abs_stride;
+      CORE_ADDR lo = line;
+      CORE_ADDR hi = line + dcache->line_size;
+
+      if (dcache->stride > 0)
+	hi += span;
+      else
+	lo -= span;
+
+      /* Don't wrap around the ends of the address space.  */
+      if (lo <= line && hi > line
+	  && dcache_read_ahead (dcache, db, lo, hi))
+	return db;
+
+      /* Fall back to reading just the line, and start the walk
+	 over, since the next lines may well be unreadable too.  */
+      dcache->window = 1;
+      dcache->next_miss = line + dcache->stride;
+    }
+
+  if (!dcache_read_line (dcache, db))
+    return NULL;
+
+  return db;
+}
+
+/* Using the data cache DCACHE, copy to PTR the contents of memory at
+   address ADDR in the remote machine, up to LEN bytes but not past
+   the end of ADDR's cache line.
+
+   Returns the number of bytes copied, 0 for error.  */
+
+static int
+dcache_peek (DCACHE *dcache, CORE_ADDR addr, gdb_byte *ptr, ULONGEST len)
+{
+  struct dcache_block *db = dcache_hit (dcache, addr);
+  int offset = XFORM (dcache, addr);
+  int n;
+
+  if (db)
+    {
+      dcache->hits++;
+      if (db->prefetched)
+	{
+	  db->prefetched = false;
+	  dcache->prefetch_hits++;
+	}
+    }
+  else
+    {
+      db = dcache_miss (dcache, addr);
+      if (db == NULL)
+	return 0;
+    }
+
+  n = std::min (len, (ULONGEST) (dcache->line_size - offset));
+  memcpy (ptr, db->data + offset, n);
+  return n;
+}
+
 /* Write the byte at PTR into ADDR in the data cache.
 
    The caller should have written the data through to target memory
@@ -459,6 +625,15 @@ dcache_init (void)
   dcache->line_size = dcache_line_size;
   dcache->ptid = null_ptid;
   dcache->proc_target = nullptr;
+  dcache->last_miss = 0;
+  dcache->stride = 0;
+  dcache->window = 1;
+  dcache->next_miss = 0;
+  dcache->hits = 0;
+  dcache->misses = 0;
+  dcache->reads = 0;
+  dcache->prefetched = 0;
+  dcache->prefetch_hits = 0;
 
   return dcache;
 }
@@ -475,6 +650,7 @@ dcache_read_memory_partial (struct target_ops *ops, DCACHE *dcache,
 			    ULONGEST len, ULONGEST *xfered_len)
 {
   ULONGEST i;
+  int n;
 
   /* If this is a different thread from what we've recorded, flush the
      cache.  */
@@ -487,9 +663,10 @@ dcache_read_memory_partial (struct target_ops *ops, DCACHE *dcache,
       dcache->proc_target = proc_target;
     }
 
-  for (i = 0; i < len; i++)
+  for (i = 0; i < len; i += n)
     {
-      if (!dcache_peek_byte (dcache, memaddr + i, myaddr + i))
+      n = dcache_peek (dcache, memaddr + i, myaddr + i, len - i);
+      if (n == 0)
 	{
 	  /* That failed.  Discard its cache line so we don't have a
 	     partially read line.  */
@@ -617,6 +794,15 @@ dcache_info_1 (DCACHE *dcache, const char *exp)
 		   dcache ? (unsigned) dcache->line_size
 		   : dcache_line_size);
 
+  /* The statistics outlive a flush, so show them even when the cache
+     holds nothing.  */
+  if (dcache != NULL)
+    printf_filtered (_("Statistics: %s hits, %s misses, %s target reads, "
+		       "%s lines read ahead (%s used)\n"),
+		     pulongest (dcache->hits), pulongest (dcache->misses),
+		     pulongest (dcache->reads), pulongest (dcache->prefetched),
+		     pulongest (dcache->prefetch_hits));
+
   if (dcache == NULL || dcache->ptid == null_ptid)
     {
       printf_filtered (_("No data cache available.\n"));
@@ -698,8 +884,9 @@ exists only for compatibility reasons."),
 	    _("\
 Print information on the dcache performance.\n\
 Usage: info dcache [LINENUMBER]\n\
-With no arguments, this command prints the cache configuration and a\n\
-summary of each line in the cache.  With an argument, dump\"\n\
+With no arguments, this command prints the cache configuration, a\n\
+summary of each line in the cache and hit, miss and read-ahead\n\
+statistics.  With an argument, dump\"\n\
 the contents of the given line."));
 
   add_setshow_prefix_cmd ("dcache", class_obscure,
@@ -725,4 +912,15 @@ Show number of dcache lines."),
 			     set_dcache_size,
 			     NULL,
 			     &dcache_set_list, &dcache_show_list);
+  add_setshow_zuinteger_cmd ("readahead", class_obscure,
+			     &dcache_readahead, _("\
+Set the most dcache lines read from the target at once."), _("\
+Show the most dcache lines read from the target at once."), _("\
+When the misses in the dcache look like a sequential or strided walk\n\
+through memory, the lines the walk should touch next are read along\n\
+with the line that missed, up to this many lines in one request.\n\
+A value below 2 disables this read-ahead."),
+			     NULL,
+			     NULL,
+			     &dcache_set_list, &dcache_show_list);
 }
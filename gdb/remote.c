@@ -78,6 +78,8 @@
 #include "gdbsupport/search.h"
 #include <algorithm>
 #include <unordered_map>
+#include <deque>
+#include <zlib.h>
 #include "async-event.h"
 #include "gdbsupport/selftest.h"
 
@@ -860,6 +862,11 @@ class remote_target : public process_stratum_target
 
   void check_binary_download (CORE_ADDR addr);
 
+  int build_write_bytes_packet (const char *header, CORE_ADDR memaddr,
+				const gdb_byte *myaddr, ULONGEST len_units,
+				int unit_size, char packet_format,
+				int use_length, int *units_written);
+
   target_xfer_status remote_write_bytes_aux (const char *header,
 					     CORE_ADDR memaddr,
 					     const gdb_byte *myaddr,
@@ -869,14 +876,43 @@ class remote_target : public process_stratum_target
 					     char packet_format,
 					     int use_length);
 
+  target_xfer_status remote_write_bytes_pipelined (const char *header,
+						   CORE_ADDR memaddr,
+						   const gdb_byte *myaddr,
+						   ULONGEST len_units,
+						   int unit_size,
+						   ULONGEST *xfered_len_units);
+
+  target_xfer_status remote_write_bytes_compressed (CORE_ADDR memaddr,
+						    const gdb_byte *myaddr,
+						    ULONGEST len_units,
+						    int unit_size,
+						    ULONGEST *xfered_len_units);
+
   target_xfer_status remote_write_bytes (CORE_ADDR memaddr,
 					 const gdb_byte *myaddr, ULONGEST len,
 					 int unit_size, ULONGEST *xfered_len);
 
+  bool remote_memory_pipelining_p ();
+
+  void getpkt_pipelined ();
+
   target_xfer_status remote_read_bytes_1 (CORE_ADDR memaddr, gdb_byte *myaddr,
 					  ULONGEST len_units,
 					  int unit_size, ULONGEST *xfered_len_units);
 
+  target_xfer_status remote_read_bytes_pipelined (CORE_ADDR memaddr,
+						  gdb_byte *myaddr,
+						  ULONGEST len_units,
+						  int unit_size,
+						  ULONGEST *xfered_len_units);
+
+  target_xfer_status remote_read_bytes_compressed (CORE_ADDR memaddr,
+						   gdb_byte *myaddr,
+						   ULONGEST len_units,
+						   int unit_size,
+						   ULONGEST *xfered_len_units);
+
   target_xfer_status remote_xfer_live_readonly_partial (gdb_byte *readbuf,
 							ULONGEST memaddr,
 							ULONGEST len,
@@ -1797,6 +1833,16 @@ show_memory_write_packet_size (const char *args, int from_tty)
   show_memory_packet_size (&memory_write_packet_config);
 }
 
+/* Show the number of memory packets that may be in flight at once.  */
+
+static void
+show_memory_pipeline_depth (struct ui_file *file, int from_tty,
+			    struct cmd_list_element *c, const char *value)
+{
+  fprintf_filtered (file, _("The number of memory packets that may be "
+			    "in flight at once is %s.\n"), value);
+}
+
 /* Show the number of hardware watchpoints that can be used.  */
 
 static void
@@ -2211,6 +2257,14 @@ enum {
      packets and the tag violation stop replies.  */
   PACKET_memory_tagging_feature,
 
+  /* Support for several memory read or write packets in flight at
+     once.  */
+  PACKET_memory_pipelining_feature,
+
+  /* Support for the zlib-compressed memory read and write packets.  */
+  PACKET_vZRead,
+  PACKET_vZWrite,
+
   PACKET_MAX
 };
 
@@ -5408,6 +5462,10 @@ static const struct protocol_feature remote_protocol_features[] = {
   { "no-resumed", PACKET_DISABLE, remote_supported_packet, PACKET_no_resumed },
   { "memory-tagging", PACKET_DISABLE, remote_supported_packet,
     PACKET_memory_tagging_feature },
+  { "memory-pipelining", PACKET_DISABLE, remote_supported_packet,
+    PACKET_memory_pipelining_feature },
+  { "vZRead", PACKET_DISABLE, remote_supported_packet, PACKET_vZRead },
+  { "vZWrite", PACKET_DISABLE, remote_supported_packet, PACKET_vZWrite },
 };
 
 static char *remote_support_xml;
@@ -8928,65 +8986,28 @@ align_for_efficient_write (int todo, CORE_ADDR memaddr)
   return ((memaddr + todo) & ~(REMOTE_ALIGN_WRITES - 1)) - memaddr;
 }
 
-/* Write memory data directly to the remote machine.
-   This does not inform the data cache; the data cache uses this.
-   HEADER is the starting part of the packet.
-   MEMADDR is the address in the remote memory space.
-   MYADDR is the address of the buffer in our space.
-   LEN_UNITS is the number of addressable units to write.
-   UNIT_SIZE is the length in bytes of an addressable unit.
-   PACKET_FORMAT should be either 'X' or 'M', and indicates if we
-   should send data as binary ('X'), or hex-encoded ('M').
-
-   The function creates packet of the form
-       <HEADER><ADDRESS>,<LENGTH>:<DATA>
-
-   where encoding of <DATA> is terminated by PACKET_FORMAT.
-
-   If USE_LENGTH is 0, then the <LENGTH> field and the preceding comma
-   are omitted.
-
-   Return the transferred status, error or OK (an
-   'enum target_xfer_status' value).  Save the number of addressable units
-   transferred in *XFERED_LEN_UNITS.  Only transfer a single packet.
-
-   On a platform with an addressable memory size of 2 bytes (UNIT_SIZE == 2), an
-   exchange between gdb and the stub could look like (?? in place of the
-   checksum):
-
-   -> $m1000,4#??
-   <- aaaabbbbccccdddd
-
-   -> $M1000,3:eeeeffffeeee#??
-   <- OK
-
-   -> $m1000,4#??
-   <- eeeeffffeeeedddd  */
+/* Build in the packet buffer a memory write packet for at most
+   LEN_UNITS addressable units of MYADDR, to be written at MEMADDR.
+   See remote_write_bytes_aux for HEADER, PACKET_FORMAT and
+   USE_LENGTH.  Return the length of the packet, and save the number
+   of units it carries in *UNITS_WRITTEN.  */
 
-target_xfer_status
-remote_target::remote_write_bytes_aux (const char *header, CORE_ADDR memaddr,
-				       const gdb_byte *myaddr,
-				       ULONGEST len_units,
-				       int unit_size,
-				       ULONGEST *xfered_len_units,
-				       char packet_format, int use_length)
+int
+remote_target::build_write_bytes_packet (const char *header,
+					 CORE_ADDR memaddr,
+					 const gdb_byte *myaddr,
+					 ULONGEST len_units, int unit_size,
+					 char packet_format, int use_length,
+					 int *units_written)
 {
   struct remote_state *rs = get_remote_state ();
   char *p;
   char *plen = NULL;
   int plenlen = 0;
   int todo_units;
-  int units_written;
   int payload_capacity_bytes;
   int payload_length_bytes;
 
-  if (packet_format != 'X' && packet_format != 'M')
-    internal_error (__FILE__, __LINE__,
-		    _("remote_write_bytes_aux: bad packet format"));
-
-  if (len_units == 0)
-    return TARGET_XFER_EOF;
-
   payload_capacity_bytes = get_memory_write_packet_size ();
 
   /* The packet buffer will be large enough for the payload;
@@ -9067,32 +9088,33 @@ remote_target::remote_write_bytes_aux (const char *header, CORE_ADDR memaddr,
 	 characters.  */
       payload_length_bytes =
 	  remote_escape_output (myaddr, todo_units, unit_size, (gdb_byte *) p,
-				&units_written, payload_capacity_bytes);
+				units_written, payload_capacity_bytes);
 
       /* If not all TODO units fit, then we'll need another packet.  Make
 	 a second try to keep the end of the packet aligned.  Don't do
 	 this if the packet is tiny.  */
-      if (units_written < todo_units && units_written > 2 * REMOTE_ALIGN_WRITES)
+      if (*units_written < todo_units
+	  && *units_written > 2 * REMOTE_ALIGN_WRITES)
 	{
 	  int new_todo_units;
 
-	  new_todo_units = align_for_efficient_write (units_written, memaddr);
+	  new_todo_units = align_for_efficient_write (*units_written, memaddr);
 
-	  if (new_todo_units != units_written)
+	  if (new_todo_units != *units_written)
 	    payload_length_bytes =
 		remote_escape_output (myaddr, new_todo_units, unit_size,
-				      (gdb_byte *) p, &units_written,
+				      (gdb_byte *) p, units_written,
 				      payload_capacity_bytes);
 	}
 
       p += payload_length_bytes;
-      if (use_length && units_written < todo_units)
+      if (use_length && *units_written < todo_units)
 	{
 	  /* Escape chars have filled up the buffer prematurely,
 	     and we have actually sent fewer units than planned.
 	     Fix-up the length field of the packet.  Use the same
 	     number of characters as before.  */
-	  plen += hexnumnstr (plen, (ULONGEST) units_written,
+	  plen += hexnumnstr (plen, (ULONGEST) *units_written,
 			      plenlen);
 	  *plen = ':';  /* overwrite \0 from hexnumnstr() */
 	}
@@ -9103,10 +9125,70 @@ remote_target::remote_write_bytes_aux (const char *header, CORE_ADDR memaddr,
 	 increasing byte addresses.  Each byte is encoded as a two hex
 	 value.  */
       p += 2 * bin2hex (myaddr, p, todo_units * unit_size);
-      units_written = todo_units;
+      *units_written = todo_units;
     }
 
-  putpkt_binary (rs->buf.data (), (int) (p - rs->buf.data ()));
+  return p - rs->buf.data ();
+}
+
+/* Write memory data directly to the remote machine.
+   This does not inform the data cache; the data cache uses this.
+   HEADER is the starting part of the packet.
+   MEMADDR is the address in the remote memory space.
+   MYADDR is the address of the buffer in our space.
+   LEN_UNITS is the number of addressable units to write.
+   UNIT_SIZE is the length in bytes of an addressable unit.
+   PACKET_FORMAT should be either 'X' or 'M', and indicates if we
+   should send data as binary ('X'), or hex-encoded ('M').
+
+   The function creates packet of the form
+       <HEADER><ADDRESS>,<LENGTH>:<DATA>
+
+   where encoding of <DATA> is terminated by PACKET_FORMAT.
+
+   If USE_LENGTH is 0, then the <LENGTH> field and the preceding comma
+   are omitted.
+
+   Return the transferred status, error or OK (an
+   'enum target_xfer_status' value).  Save the number of addressable units
+   transferred in *XFERED_LEN_UNITS.  Only transfer a single packet.
+
+   On a platform with an addressable memory size of 2 bytes (UNIT_SIZE == 2), an
+   exchange between gdb and the stub could look like (?? in place of the
+   checksum):
+
+   -> $m1000,4#??
+   <- aaaabbbbccccdddd
+
+   -> $M1000,3:eeeeffffeeee#??
+   <- OK
+
+   -> $m1000,4#??
+   <- eeeeffffeeeedddd  */
+
+target_xfer_status
+remote_target::remote_write_bytes_aux (const char *header, CORE_ADDR memaddr,
+				       const gdb_byte *myaddr,
+				       ULONGEST len_units,
+				       int unit_size,
+				       ULONGEST *xfered_len_units,
+				       char packet_format, int use_length)
+{
+  struct remote_state *rs = get_remote_state ();
+  int units_written;
+  int packet_len;
+
+  if (packet_format != 'X' && packet_format != 'M')
+    internal_error (__FILE__, __LINE__,
+		    _("remote_write_bytes_aux: bad packet format"));
+
+  if (len_units == 0)
+    return TARGET_XFER_EOF;
+
+  packet_len = build_write_bytes_packet (header, memaddr, myaddr, len_units,
+					 unit_size, packet_format, use_length,
+					 &units_written);
+  putpkt_binary (rs->buf.data (), packet_len);
   getpkt (&rs->buf, 0);
 
   if (rs->buf[0] == 'E')
@@ -9118,6 +9200,214 @@ remote_target::remote_write_bytes_aux (const char *header, CORE_ADDR memaddr,
   return (*xfered_len_units != 0) ? TARGET_XFER_OK : TARGET_XFER_EOF;
 }
 
+/* The number of memory read or write packets that may be in flight at
+   once, when the remote stub supports it.  */
+
+static unsigned int remote_memory_pipeline_depth = 8;
+
+/* The most packets a single pipelined transfer sends, so that a large
+   transfer still returns to the caller now and then.  This also caps
+   REMOTE_MEMORY_PIPELINE_DEPTH.  */
+
+#define REMOTE_PIPELINE_MAX_PACKETS 256
+
+/* Clamp "set remote memory-pipeline-depth" to the number of packets a
+   transfer can have in flight.  */
+
+static void
+set_memory_pipeline_depth (const char *args, int from_tty,
+			   struct cmd_list_element *c)
+{
+  if (remote_memory_pipeline_depth > REMOTE_PIPELINE_MAX_PACKETS)
+    remote_memory_pipeline_depth = REMOTE_PIPELINE_MAX_PACKETS;
+}
+
+/* Return true if several memory packets may be sent before reading
+   their replies.  The stub must process packets in order and say so,
+   and acknowledgments must be off, since waiting for each packet's
+   '+' would serialize the transfer again.  */
+
+bool
+remote_target::remote_memory_pipelining_p ()
+{
+  struct remote_state *rs = get_remote_state ();
+
+  return (rs->noack_mode
+	  && remote_memory_pipeline_depth > 1
+	  && (packet_support (PACKET_memory_pipelining_feature)
+	      == PACKET_ENABLE));
+}
+
+/* Read the reply to the oldest pipelined memory packet into RS->BUF.
+   If it cannot be read, the replies to the packets still in flight
+   would be taken for the replies to later packets, so close the
+   connection before throwing.  */
+
+void
+remote_target::getpkt_pipelined ()
+{
+  struct remote_state *rs = get_remote_state ();
+  int ret;
+
+  try
+    {
+      ret = getpkt_sane (&rs->buf, 0);
+    }
+  catch (const gdb_exception &ex)
+    {
+      /* A TARGET_CLOSE_ERROR has already closed the connection.  */
+      if (ex.error != TARGET_CLOSE_ERROR)
+	remote_unpush_target (this);
+      throw;
+    }
+
+  if (ret < 0)
+    {
+      remote_unpush_target (this);
+      throw_error (TARGET_CLOSE_ERROR,
+		   _("No reply to a pipelined memory packet.  "
+		     "Target disconnected."));
+    }
+}
+
+/* Like remote_write_bytes_aux, for an 'X' or 'M' HEADER, but keep up
+   to REMOTE_MEMORY_PIPELINE_DEPTH packets in flight.  The replies come
+   back in order; the transfer stops at the first error, although the
+   packets already sent after it are still drained.  */
+
+target_xfer_status
+remote_target::remote_write_bytes_pipelined (const char *header,
+					     CORE_ADDR memaddr,
+					     const gdb_byte *myaddr,
+					     ULONGEST len_units,
+					     int unit_size,
+					     ULONGEST *xfered_len_units)
+{
+  struct remote_state *rs = get_remote_state ();
+  std::deque<int> in_flight;
+  ULONGEST sent_units = 0;
+  ULONGEST written_units = 0;
+  unsigned int n_packets = 0;
+  bool failed = false;
+
+  while (true)
+    {
+      while (!failed
+	     && sent_units < len_units
+	     && in_flight.size () < remote_memory_pipeline_depth
+	     && n_packets < REMOTE_PIPELINE_MAX_PACKETS)
+	{
+	  int units;
+	  int packet_len
+	    = build_write_bytes_packet (header, memaddr + sent_units,
+					myaddr + sent_units * unit_size,
+					len_units - sent_units, unit_size,
+					header[0], 1, &units);
+
+	  putpkt_binary (rs->buf.data (), packet_len);
+	  in_flight.push_back (units);
+	  sent_units += units;
+	  n_packets++;
+	}
+
+      if (in_flight.empty ())
+	break;
+
+      getpkt_pipelined ();
+      if (rs->buf[0] == 'E')
+	failed = true;
+      else if (!failed)
+	written_units += in_flight.front ();
+      in_flight.pop_front ();
+    }
+
+  *xfered_len_units = written_units;
+  if (written_units != 0)
+    return TARGET_XFER_OK;
+  return failed ? TARGET_XFER_E_IO : TARGET_XFER_EOF;
+}
+
+/* The most data, in bytes, that one vZRead or vZWrite packet asks for
+   before compression.  Data that does not compress well enough to fit
+   in a single packet is sent in smaller pieces.  */
+
+#define REMOTE_ZMEM_MAX_BYTES 0x10000
+
+/* Transfers smaller than this use the plain memory packets; the zlib
+   header and checksum would eat most of what compression saves.  */
+
+#define REMOTE_ZMEM_MIN_BYTES 64
+
+/* Write LEN_UNITS addressable units of MYADDR to MEMADDR with a
+   "vZWrite:ADDR,LENGTH:DATA" packet.  DATA is the zlib stream for the
+   LENGTH units, escaped as in the 'X' packet.  Send as many units as
+   compress into a single packet.  Return the transfer status like
+   remote_write_bytes_aux.  */
+
+target_xfer_status
+remote_target::remote_write_bytes_compressed (CORE_ADDR memaddr,
+					      const gdb_byte *myaddr,
+					      ULONGEST len_units,
+					      int unit_size,
+					      ULONGEST *xfered_len_units)
+{
+  struct remote_state *rs = get_remote_state ();
+  ULONGEST todo_units
+    = std::min (len_units, (ULONGEST) (REMOTE_ZMEM_MAX_BYTES / unit_size));
+  gdb::byte_vector zbuf (compressBound (todo_units * unit_size));
+  int packet_len;
+
+  while (true)
+    {
+      uLongf zlen = zbuf.size ();
+      char *p = rs->buf.data ();
+      int payload_capacity_bytes;
+      int escaped_bytes;
+
+      if (compress2 (zbuf.data (), &zlen, myaddr, todo_units * unit_size,
+		     Z_DEFAULT_COMPRESSION) != Z_OK)
+	error (_("Could not compress memory for the vZWrite packet."));
+
+      /* Construct "vZWrite:"<memaddr>","<len>":".  */
+      strcpy (p, "vZWrite:");
+      p += strlen (p);
+      p += hexnumstr (p, (ULONGEST) remote_address_masked (memaddr));
+      *p++ = ',';
+      p += hexnumstr (p, todo_units);
+      *p++ = ':';
+
+      payload_capacity_bytes = (get_memory_write_packet_size ()
+				- (p - rs->buf.data ()) - strlen ("$#NN"));
+      packet_len = remote_escape_output (zbuf.data (), zlen, 1,
+					 (gdb_byte *) p, &escaped_bytes,
+					 payload_capacity_bytes);
+      if ((uLongf) escaped_bytes == zlen)
+	{
+	  packet_len += p - rs->buf.data ();
+	  break;
+	}
+
+      /* Too big.  Shrink the request in proportion to the part of
+	 the stream that did fit, with some slack since the data need
+	 not compress evenly.  */
+      if (todo_units == 1)
+	error (_("Compressed memory does not fit in a vZWrite packet."));
+      todo_units = std::max ((ULONGEST) 1,
+			     std::min (todo_units / 2,
+				       todo_units * escaped_bytes / zlen
+				       * 7 / 8));
+    }
+
+  putpkt_binary (rs->buf.data (), packet_len);
+  getpkt (&rs->buf, 0);
+  if (packet_ok (rs->buf, &remote_protocol_packets[PACKET_vZWrite])
+      != PACKET_OK)
+    return TARGET_XFER_E_IO;
+
+  *xfered_len_units = todo_units;
+  return TARGET_XFER_OK;
+}
+
 /* Write memory data directly to the remote machine.
    This does not inform the data cache; the data cache uses this.
    MEMADDR is the address in the remote memory space.
@@ -9153,6 +9443,15 @@ remote_target::remote_write_bytes (CORE_ADDR memaddr, const gdb_byte *myaddr,
       internal_error (__FILE__, __LINE__, _("bad switch"));
     }
 
+  if (len * unit_size >= REMOTE_ZMEM_MIN_BYTES
+      && packet_support (PACKET_vZWrite) == PACKET_ENABLE)
+    return remote_write_bytes_compressed (memaddr, myaddr, len, unit_size,
+					  xfered_len);
+
+  if (remote_memory_pipelining_p ())
+    return remote_write_bytes_pipelined (packet_format, memaddr, myaddr,
+					 len, unit_size, xfered_len);
+
   return remote_write_bytes_aux (packet_format,
 				 memaddr, myaddr, len, unit_size, xfered_len,
 				 packet_format[0], 1);
@@ -9191,6 +9490,15 @@ remote_target::remote_read_bytes_1 (CORE_ADDR memaddr, gdb_byte *myaddr,
   todo_units = std::min (len_units,
 			 (ULONGEST) (buf_size_bytes / unit_size) / 2);
 
+  if (len_units * unit_size >= REMOTE_ZMEM_MIN_BYTES
+      && packet_support (PACKET_vZRead) == PACKET_ENABLE)
+    return remote_read_bytes_compressed (memaddr, myaddr, len_units,
+					 unit_size, xfered_len_units);
+
+  if (todo_units < len_units && remote_memory_pipelining_p ())
+    return remote_read_bytes_pipelined (memaddr, myaddr, len_units,
+					unit_size, xfered_len_units);
+
   /* Construct "m"<memaddr>","<len>".  */
   memaddr = remote_address_masked (memaddr);
   p = rs->buf.data ();
@@ -9214,6 +9522,134 @@ remote_target::remote_read_bytes_1 (CORE_ADDR memaddr, gdb_byte *myaddr,
   return (*xfered_len_units != 0) ? TARGET_XFER_OK : TARGET_XFER_EOF;
 }
 
+/* Like remote_read_bytes_1, but for a transfer that needs several
+   packets, keep up to REMOTE_MEMORY_PIPELINE_DEPTH of them in flight.
+   The replies come back in order; the transfer stops at the first
+   error or short reply, although the packets already sent after it
+   are still drained.  */
+
+target_xfer_status
+remote_target::remote_read_bytes_pipelined (CORE_ADDR memaddr,
+					    gdb_byte *myaddr,
+					    ULONGEST len_units,
+					    int unit_size,
+					    ULONGEST *xfered_len_units)
+{
+  struct remote_state *rs = get_remote_state ();
+  ULONGEST packet_units
+    = (ULONGEST) (get_memory_read_packet_size () / unit_size) / 2;
+  std::deque<ULONGEST> in_flight;
+  ULONGEST sent_units = 0;
+  ULONGEST read_units = 0;
+  unsigned int n_packets = 0;
+  bool failed = false;
+  bool io_error = false;
+
+  while (true)
+    {
+      while (!failed
+	     && sent_units < len_units
+	     && in_flight.size () < remote_memory_pipeline_depth
+	     && n_packets < REMOTE_PIPELINE_MAX_PACKETS)
+	{
+	  ULONGEST units = std::min (packet_units, len_units - sent_units);
+	  char *p = rs->buf.data ();
+
+	  /* Construct "m"<memaddr>","<len>".  */
+	  *p++ = 'm';
+	  p += hexnumstr (p, (ULONGEST) remote_address_masked (memaddr
+							       + sent_units));
+	  *p++ = ',';
+	  p += hexnumstr (p, units);
+	  *p = '\0';
+	  putpkt (rs->buf);
+	  in_flight.push_back (units);
+	  sent_units += units;
+	  n_packets++;
+	}
+
+      if (in_flight.empty ())
+	break;
+
+      getpkt_pipelined ();
+      if (!failed)
+	{
+	  ULONGEST units = in_flight.front ();
+
+	  if (rs->buf[0] == 'E'
+	      && isxdigit (rs->buf[1]) && isxdigit (rs->buf[2])
+	      && rs->buf[3] == '\0')
+	    failed = io_error = true;
+	  else
+	    {
+	      int decoded_bytes
+		= hex2bin (rs->buf.data (), myaddr + read_units * unit_size,
+			   units * unit_size);
+
+	      read_units += decoded_bytes / unit_size;
+	      if (decoded_bytes / unit_size != units)
+		failed = true;
+	    }
+	}
+      in_flight.pop_front ();
+    }
+
+  *xfered_len_units = read_units;
+  if (read_units != 0)
+    return TARGET_XFER_OK;
+  return io_error ? TARGET_XFER_E_IO : TARGET_XFER_EOF;
+}
+
+/* Read LEN_UNITS addressable units at MEMADDR into MYADDR with a
+   "vZRead:ADDR,LENGTH" packet.  The stub replies with 'Z' and the
+   escaped zlib stream for at most LENGTH units; it may send fewer if
+   the compressed data would not fit in one packet.  Return the
+   transfer status like remote_read_bytes_1.  */
+
+target_xfer_status
+remote_target::remote_read_bytes_compressed (CORE_ADDR memaddr,
+					     gdb_byte *myaddr,
+					     ULONGEST len_units,
+					     int unit_size,
+					     ULONGEST *xfered_len_units)
+{
+  struct remote_state *rs = get_remote_state ();
+  ULONGEST todo_units
+    = std::min (len_units, (ULONGEST) (REMOTE_ZMEM_MAX_BYTES / unit_size));
+  char *p = rs->buf.data ();
+  int packet_len;
+  int zlen;
+  uLongf read_bytes;
+
+  /* Construct "vZRead:"<memaddr>","<len>".  */
+  strcpy (p, "vZRead:");
+  p += strlen (p);
+  p += hexnumstr (p, (ULONGEST) remote_address_masked (memaddr));
+  *p++ = ',';
+  p += hexnumstr (p, todo_units);
+  *p = '\0';
+  putpkt (rs->buf);
+  packet_len = getpkt_sane (&rs->buf, 0);
+  if (packet_len < 0
+      || (packet_ok (rs->buf, &remote_protocol_packets[PACKET_vZRead])
+	  != PACKET_OK))
+    return TARGET_XFER_E_IO;
+
+  if (rs->buf[0] != 'Z')
+    error (_("Unknown remote vZRead reply: %s"), rs->buf.data ());
+
+  gdb::byte_vector zbuf (packet_len);
+  zlen = remote_unescape_input ((gdb_byte *) rs->buf.data () + 1,
+				packet_len - 1, zbuf.data (), zbuf.size ());
+  read_bytes = todo_units * unit_size;
+  if (uncompress (myaddr, &read_bytes, zbuf.data (), zlen) != Z_OK)
+    error (_("Could not decompress the remote vZRead reply."));
+
+  /* Return what we have.  Let higher layers handle partial reads.  */
+  *xfered_len_units = (ULONGEST) (read_bytes / unit_size);
+  return (*xfered_len_units != 0) ? TARGET_XFER_OK : TARGET_XFER_EOF;
+}
+
 /* Using the set of read-only target sections of remote, read live
    read-only memory.
 
@@ -15026,6 +15462,17 @@ further restriction and ``limit'' to enable that restriction."),
 	   _("Show the maximum number of bytes per memory-read packet."),
 	   &remote_show_cmdlist);
 
+  add_setshow_zuinteger_cmd ("memory-pipeline-depth", no_class,
+			     &remote_memory_pipeline_depth, _("\
+Set the number of memory packets that may be in flight at once."), _("\
+Show the number of memory packets that may be in flight at once."), _("\
+When the remote stub supports it, memory reads and writes that need\n\
+several packets send up to this many, at most 256, before waiting for\n\
+the replies.  0 or 1 sends one packet at a time."),
+			     set_memory_pipeline_depth,
+			     show_memory_pipeline_depth,
+			     &remote_set_cmdlist, &remote_show_cmdlist);
+
   add_setshow_zuinteger_unlimited_cmd ("hardware-watchpoint-limit", no_class,
 			    &remote_hw_watchpoint_limit, _("\
 Set the maximum number of target hardware watchpoints."), _("\
@@ -15313,6 +15760,22 @@ Show the maximum size of the address (in bits) in a memory packet."), NULL,
   add_packet_config_cmd (&remote_protocol_packets[PACKET_memory_tagging_feature],
 			 "memory-tagging-feature", "memory-tagging-feature", 0);
 
+  add_packet_config_cmd
+    (&remote_protocol_packets[PACKET_memory_pipelining_feature],
+     "memory-pipelining-feature", "memory-pipelining-feature", 0);
+
+  add_packet_config_cmd (&remote_protocol_packets[PACKET_vZRead],
+			 "vZRead", "compressed-read", 0);
+
+  add_packet_config_cmd (&remote_protocol_packets[PACKET_vZWrite],
+			 "vZWrite", "compressed-write", 0);
+
+  /* The compressed packets are sent one at a time and take precedence
+     over the pipelined 'm' and 'X' packets, which are faster on most
+     links.  Only use them when the user asks for them.  */
+  remote_protocol_packets[PACKET_vZRead].detect = AUTO_BOOLEAN_FALSE;
+  remote_protocol_packets[PACKET_vZWrite].detect = AUTO_BOOLEAN_FALSE;
+
   /* Assert that we've registered "set remote foo-packet" commands
      for all packet configs.  */
   {
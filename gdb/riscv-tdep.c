@@ -57,6 +57,9 @@
 #include "prologue-value.h"
 #include "arch/riscv.h"
 #include "riscv-ravenscar-thread.h"
+#include "disasm.h"
+#include "gdbsupport/selftest.h"
+#include <unordered_map>
 
 /* The stack must be 16-byte aligned.  */
 #define SP_ALIGNMENT 16
@@ -1396,6 +1399,43 @@ riscv_print_registers_info (struct gdbarch *gdbarch,
     }
 }
 
+/* What the prologue scanner knows about the code of one objfile: the
+   extensions which change how 16-bit instructions decode, and the
+   contents of the Andes exec.it table the linker built, read from the
+   file so that expanding an exec.it costs no target access.  */
+
+struct riscv_objfile_code
+{
+  /* True if Zcmp is enabled, so cm.push is decoded instead of c.fsdsp.  */
+  bool zcmp = false;
+
+  /* True if the exec.it table is indexed by nexec.it instead of
+     exec.it.  */
+  bool nexecit = false;
+
+  /* The contents of the .exec.itable section, empty if there is none.  */
+  gdb::byte_vector execit_table;
+
+  /* If IVAL is an exec.it, set *ENTRY to the instruction of the exec.it
+     table it stands for, and return true.  */
+  bool execit_entry (ULONGEST ival, ULONGEST *entry) const
+  {
+    ULONGEST index;
+
+    if (execit_table.empty ())
+      return false;
+    if (nexecit ? !is_nexec_it_insn (ival) : !is_exec_it_insn (ival))
+      return false;
+    index = (nexecit ? EXTRACT_RVC_NEXECIT_IMM (ival)
+	     : EXTRACT_RVC_EXECIT_IMM (ival)) >> 2;
+    if ((index + 1) * 4 > execit_table.size ())
+      return false;
+    *entry = extract_unsigned_integer (execit_table.data () + index * 4, 4,
+				       BFD_ENDIAN_LITTLE);
+    return true;
+  }
+};
+
 /* Class that handles one decoded RiscV instruction.  */
 
 class riscv_insn
@@ -1410,6 +1450,7 @@ class riscv_insn
 
       /* These instructions are all the ones we are interested in during the
 	 prologue scan.  */
+      CM_PUSH,
       ADD,
       ADDI,
       ADDIW,
@@ -1446,12 +1487,17 @@ class riscv_insn
       m_opcode (OTHER),
       m_rd (0),
       m_rs1 (0),
-      m_rs2 (0)
+      m_rs2 (0),
+      m_rlist (0)
   {
     /* Nothing.  */
   }
 
-  void decode (struct gdbarch *gdbarch, CORE_ADDR pc);
+  /* Decode the instruction at PC.  If CODE is not NULL, the instructions
+     of the extensions it enables are decoded too, and an exec.it is
+     decoded as the instruction it executes, keeping its own length.  */
+  void decode (struct gdbarch *gdbarch, CORE_ADDR pc,
+	       const riscv_objfile_code *code = nullptr);
 
   /* Get the length of the instruction in bytes.  */
   int length () const
@@ -1483,8 +1529,43 @@ class riscv_insn
   int imm_signed () const
   { return m_imm.s; }
 
+  /* Get the registers saved by a CM_PUSH, as a mask of register
+     numbers.  */
+  unsigned int rlist () const
+  { return m_rlist; }
+
 private:
 
+  /* Decode the instruction IVAL of M_LENGTH bytes.  */
+  void decode_ival (struct gdbarch *gdbarch, ULONGEST ival,
+		    const riscv_objfile_code *code);
+
+  /* Helper for DECODE, decode 16-bit Zcmp cm.push instruction.  */
+  void decode_cm_push_insn (struct gdbarch *gdbarch, ULONGEST ival)
+  {
+    int xlen = riscv_isa_xlen (gdbarch);
+    unsigned int rlist = (ival >> OP_SH_RLIST) & OP_MASK_RLIST;
+    unsigned int count, adj;
+
+    /* {ra}, {ra, s0}, {ra, s0-s1}, ... {ra, s0-s9}, and then {ra, s0-s11}
+       as there is no {ra, s0-s10}.  */
+    if (rlist < 4)
+      {
+	m_opcode = OTHER;
+	return;
+      }
+    count = rlist - 3 + (rlist == 15 ? 1 : 0);
+    m_rlist = 1u << RISCV_RA_REGNUM;
+    for (unsigned int i = 1; i < count; i++)
+      m_rlist |= 1u << (i <= 2 ? RISCV_FP_REGNUM + i - 1 : 18 + i - 3);
+
+    adj = align_up (count * xlen, 16) + EXTRACT_ZCMP_SPIMM (ival);
+    m_opcode = CM_PUSH;
+    m_rd = RISCV_SP_REGNUM;
+    m_rs1 = RISCV_SP_REGNUM;
+    m_imm.s = -adj;
+  }
+
   /* Extract 5 bit register field at OFFSET from instruction OPCODE.  */
   int decode_register_index (unsigned long opcode, int offset)
   {
@@ -1631,6 +1712,9 @@ class riscv_insn
   int m_rs1;
   int m_rs2;
 
+  /* The registers saved by a CM_PUSH.  */
+  unsigned int m_rlist;
+
   /* Possible instruction immediate.  This is only valid if the instruction
      format contains an immediate, not all instruction, whether this is
      valid depends on the opcode.  Despite only having one format for now
@@ -1685,13 +1769,36 @@ riscv_insn::fetch_instruction (struct gdbarch *gdbarch,
    handling this error if that is appropriate.  */
 
 void
-riscv_insn::decode (struct gdbarch *gdbarch, CORE_ADDR pc)
+riscv_insn::decode (struct gdbarch *gdbarch, CORE_ADDR pc,
+		    const riscv_objfile_code *code)
 {
-  ULONGEST ival;
+  ULONGEST ival, entry;
 
   /* Fetch the instruction, and the instructions length.  */
   ival = fetch_instruction (gdbarch, pc, &m_length);
 
+  if (code != nullptr && m_length == 2 && code->execit_entry (ival, &entry))
+    {
+      m_length = riscv_insn_length (entry);
+      if (m_length == 2)
+	entry &= 0xffff;
+      decode_ival (gdbarch, entry, code);
+      m_length = 2;
+
+      /* The table entries of the pc-relative and jump instructions are
+	 relative to the exec.it, not to the table, leave these alone.  */
+      if (m_opcode == AUIPC || m_opcode == JAL)
+	m_opcode = OTHER;
+      return;
+    }
+
+  decode_ival (gdbarch, ival, code);
+}
+
+void
+riscv_insn::decode_ival (struct gdbarch *gdbarch, ULONGEST ival,
+			 const riscv_objfile_code *code)
+{
   if (m_length == 4)
     {
       if (is_add_insn (ival))
@@ -1751,7 +1858,9 @@ riscv_insn::decode (struct gdbarch *gdbarch, CORE_ADDR pc)
       /* C_ADD and C_JALR have the same opcode.  If RS2 is 0, then this is a
 	 C_JALR.  So must try to match C_JALR first as it has more bits in
 	 mask.  */
-      if (is_c_jalr_insn (ival))
+      if (code != nullptr && code->zcmp && is_cm_push_insn (ival))
+	decode_cm_push_insn (gdbarch, ival);
+      else if (is_c_jalr_insn (ival))
 	decode_cr_type_insn (JALR, ival);
       else if (is_c_add_insn (ival))
 	decode_cr_type_insn (ADD, ival);
@@ -1827,18 +1936,88 @@ riscv_insn::decode (struct gdbarch *gdbarch, CORE_ADDR pc)
     }
 }
 
-/* The prologue scanner.  This is currently only used for skipping the
-   prologue of a function when the DWARF information is not sufficient.
-   However, it is written with filling of the frame cache in mind, which
-   is why different groups of stack setup instructions are split apart
-   during the core of the inner loop.  In the future, the intention is to
-   extend this function to fully support building up a frame cache that
-   can unwind register values when there is no DWARF information.  */
+/* What the prologue scanner found out about a function: how to find the
+   frame base, and where the registers are saved, as offsets from the
+   frame base.  */
+
+struct riscv_prologue_summary
+{
+  /* The address of the first instruction after the prologue.  */
+  CORE_ADDR end_prologue;
+
+  /* As in riscv_unwind_cache.  */
+  int frame_base_reg;
+  int frame_base_offset;
+
+  /* The saved registers, and their offsets from the frame base.  */
+  std::vector<std::pair<int, CORE_ADDR>> saved_regs;
+};
+
+/* The prologue scanner data of one objfile.  The summaries are kept by
+   function start address for as long as the objfile is loaded, so that
+   unwinding through a function on later stops reads none of its code
+   from the target.  */
+
+struct riscv_objfile_data
+{
+  riscv_objfile_code code;
+  std::unordered_map<CORE_ADDR, riscv_prologue_summary> prologues;
+};
+
+static const objfile_key<riscv_objfile_data> riscv_objfile_data_key;
+
+/* Return the prologue scanner data of the objfile containing PC, or NULL
+   if PC is not in any objfile.  */
+
+static riscv_objfile_data *
+riscv_get_objfile_data (CORE_ADDR pc)
+{
+  struct obj_section *osect = find_pc_section (pc);
+  if (osect == nullptr)
+    return nullptr;
+
+  struct objfile *objfile = osect->objfile;
+  riscv_objfile_data *data = riscv_objfile_data_key.get (objfile);
+  if (data != nullptr)
+    return data;
+
+  data = riscv_objfile_data_key.emplace (objfile);
+  bfd *abfd = objfile->obfd;
+  if (abfd != nullptr && bfd_get_flavour (abfd) == bfd_target_elf_flavour)
+    {
+      const char *arch
+	= elf_known_obj_attributes_proc (abfd)[Tag_RISCV_arch].s;
+      if (arch != nullptr)
+	{
+	  data->code.zcmp = strstr (arch, "zcmp") != nullptr;
+	  data->code.nexecit = strstr (arch, "xnexecit") != nullptr;
+	}
+
+      asection *sec = bfd_get_section_by_name (abfd, ".exec.itable");
+      if (sec != nullptr && bfd_section_size (sec) > 0)
+	{
+	  data->code.execit_table.resize (bfd_section_size (sec));
+	  if (!bfd_get_section_contents (abfd, sec,
+					 data->code.execit_table.data (), 0,
+					 bfd_section_size (sec)))
+	    data->code.execit_table.clear ();
+	}
+    }
+
+  return data;
+}
+
+/* The prologue scanner.  This is used for skipping the prologue of a
+   function when the DWARF information is not sufficient, and to fill in
+   the frame cache of the fallback unwinder.  Different groups of stack
+   setup instructions are split apart during the core of the inner loop.
+   If SUMMARY is not NULL, fill it in with the frame base and the saved
+   registers found.  */
 
 static CORE_ADDR
 riscv_scan_prologue (struct gdbarch *gdbarch,
 		     CORE_ADDR start_pc, CORE_ADDR end_pc,
-		     struct riscv_unwind_cache *cache)
+		     struct riscv_prologue_summary *summary)
 {
   CORE_ADDR cur_pc, next_pc, after_prologue_pc;
   CORE_ADDR end_prologue_addr = 0;
@@ -1857,6 +2036,9 @@ riscv_scan_prologue (struct gdbarch *gdbarch,
     regs[regno] = pv_register (regno, 0);
   pv_area stack (RISCV_SP_REGNUM, gdbarch_addr_bit (gdbarch));
 
+  riscv_objfile_data *data = riscv_get_objfile_data (start_pc);
+  const riscv_objfile_code *code = data != nullptr ? &data->code : nullptr;
+
   if (riscv_debug_unwinder)
     fprintf_unfiltered
       (gdb_stdlog,
@@ -1870,12 +2052,28 @@ riscv_scan_prologue (struct gdbarch *gdbarch,
 
       /* Decode the current instruction, and decide where the next
 	 instruction lives based on the size of this instruction.  */
-      insn.decode (gdbarch, cur_pc);
+      insn.decode (gdbarch, cur_pc, code);
       gdb_assert (insn.length () > 0);
       next_pc = cur_pc + insn.length ();
 
       /* Look for common stack adjustment insns.  */
-      if ((insn.opcode () == riscv_insn::ADDI
+      if (insn.opcode () == riscv_insn::CM_PUSH)
+	{
+	  /* Handle: cm.push {ra, s0-sN}, -i
+	     The registers are stored below the old sp, the highest
+	     numbered first, then sp is adjusted.  */
+	  int xlen = riscv_isa_xlen (gdbarch);
+	  pv_t addr = regs[RISCV_SP_REGNUM];
+	  for (int regno = RISCV_NUM_INTEGER_REGS - 1; regno > 0; regno--)
+	    if (insn.rlist () & (1u << regno))
+	      {
+		addr = pv_add_constant (addr, -xlen);
+		stack.store (addr, xlen, regs[regno]);
+	      }
+	  regs[RISCV_SP_REGNUM]
+	    = pv_add_constant (regs[RISCV_SP_REGNUM], insn.imm_signed ());
+	}
+      else if ((insn.opcode () == riscv_insn::ADDI
 	   || insn.opcode () == riscv_insn::ADDIW)
 	  && insn.rd () == RISCV_SP_REGNUM
 	  && insn.rs1 () == RISCV_SP_REGNUM)
@@ -1998,8 +2196,10 @@ riscv_scan_prologue (struct gdbarch *gdbarch,
     fprintf_unfiltered (gdb_stdlog, "End of prologue at %s\n",
 			core_addr_to_string (end_prologue_addr));
 
-  if (cache != NULL)
+  if (summary != NULL)
     {
+      summary->end_prologue = end_prologue_addr;
+
       /* Figure out if it is a frame pointer or just a stack pointer.  Also
 	 the offset held in the pv_t is from the original register value to
 	 the current value, which for a grows down stack means a negative
@@ -2007,13 +2207,13 @@ riscv_scan_prologue (struct gdbarch *gdbarch,
 	 from the current value to the original value.  */
       if (pv_is_register (regs[RISCV_FP_REGNUM], RISCV_SP_REGNUM))
 	{
-	  cache->frame_base_reg = RISCV_FP_REGNUM;
-	  cache->frame_base_offset = -regs[RISCV_FP_REGNUM].k;
+	  summary->frame_base_reg = RISCV_FP_REGNUM;
+	  summary->frame_base_offset = -regs[RISCV_FP_REGNUM].k;
 	}
       else
 	{
-	  cache->frame_base_reg = RISCV_SP_REGNUM;
-	  cache->frame_base_offset = -regs[RISCV_SP_REGNUM].k;
+	  summary->frame_base_reg = RISCV_SP_REGNUM;
+	  summary->frame_base_offset = -regs[RISCV_SP_REGNUM].k;
 	}
 
       /* Assign offset from old SP to all saved registers.  As we don't
@@ -2036,7 +2236,7 @@ riscv_scan_prologue (struct gdbarch *gdbarch,
 				      gdbarch_register_name (gdbarch, i),
 				      plongest ((LONGEST) offset));
 		}
-	      cache->regs[i].set_addr (offset);
+	      summary->saved_regs.emplace_back (i, offset);
 	    }
 	}
     }
@@ -3334,10 +3534,43 @@ riscv_frame_cache (struct frame_info *this_frame, void **this_cache)
   cache->regs = trad_frame_alloc_saved_regs (this_frame);
   (*this_cache) = cache;
 
-  /* Scan the prologue, filling in the cache.  */
+  /* Scan the prologue, filling in the cache.  The summary of the whole
+     prologue is kept, and used again by all the frames of the function
+     which are past the prologue.  A frame stopped inside the prologue
+     sees part of it only, so it is scanned up to PC and not kept.  */
   start_addr = get_frame_func (this_frame);
   pc = get_frame_pc (this_frame);
-  riscv_scan_prologue (gdbarch, start_addr, pc, cache);
+
+  riscv_prologue_summary scanned;
+  const riscv_prologue_summary *summary = nullptr;
+  riscv_objfile_data *data
+    = start_addr != 0 ? riscv_get_objfile_data (start_addr) : nullptr;
+  if (data != nullptr)
+    {
+      auto it = data->prologues.find (start_addr);
+      if (it == data->prologues.end ())
+	{
+	  riscv_prologue_summary full;
+	  riscv_scan_prologue (gdbarch, start_addr, (CORE_ADDR) -1, &full);
+	  it = data->prologues.emplace (start_addr, std::move (full)).first;
+	}
+      else if (riscv_debug_unwinder)
+	fprintf_unfiltered (gdb_stdlog,
+			    "Using the prologue summary of function at %s\n",
+			    core_addr_to_string (start_addr));
+      if (pc >= it->second.end_prologue)
+	summary = &it->second;
+    }
+  if (summary == nullptr)
+    {
+      riscv_scan_prologue (gdbarch, start_addr, pc, &scanned);
+      summary = &scanned;
+    }
+
+  cache->frame_base_reg = summary->frame_base_reg;
+  cache->frame_base_offset = summary->frame_base_offset;
+  for (const auto &reg : summary->saved_regs)
+    cache->regs[reg.first].set_addr (reg.second);
 
   /* We can now calculate the frame base address.  */
   cache->frame_base
@@ -4064,6 +4297,132 @@ riscv_supply_regset (const struct regset *regset,
     }
 }
 
+#if GDB_SELF_TEST
+
+namespace selftests {
+
+/* A disassembler reading the instructions from a buffer.  */
+
+class riscv_buffer_disassembler : public gdb_disassembler
+{
+public:
+  riscv_buffer_disassembler (struct gdbarch *gdbarch,
+			     gdb::array_view<const gdb_byte> insns)
+    : gdb_disassembler (gdbarch, &null_stream, read_memory),
+      m_insns (insns)
+  {
+  }
+
+private:
+  gdb::array_view<const gdb_byte> m_insns;
+
+  static int read_memory (bfd_vma memaddr, gdb_byte *myaddr,
+			  unsigned int len, struct disassemble_info *info)
+  {
+    riscv_buffer_disassembler *self
+      = static_cast<riscv_buffer_disassembler *> (info->application_data);
+
+    if (memaddr + len > self->m_insns.size ())
+      return -1;
+    memcpy (myaddr, self->m_insns.data () + memaddr, len);
+    return 0;
+  }
+};
+
+/* Return the opcodes of the NULL-terminated list OPS that match WORD,
+   in order.  */
+
+static std::vector<const struct riscv_opcode *>
+riscv_matching_opcodes (const struct riscv_opcode *const *ops, insn_t word)
+{
+  std::vector<const struct riscv_opcode *> result;
+
+  for (; *ops != NULL; ops++)
+    if ((*ops)->match_func (*ops, word))
+      result.push_back (*ops);
+  return result;
+}
+
+/* Check that the decode tree offers the same opcodes, in the same
+   order, as a scan of the whole opcode table would find.  */
+
+static void
+riscv_decode_tree_test ()
+{
+  const struct riscv_opcode *tables[] = { riscv_opcodes, NULL };
+  struct riscv_decode_node *tree
+    = riscv_build_decode_tree (tables, NULL, NULL);
+  std::vector<const struct riscv_opcode *> all;
+  uint32_t seed = 1;
+
+  for (const struct riscv_opcode *op = riscv_opcodes; op->name; op++)
+    if (op->pinfo != INSN_MACRO)
+      all.push_back (op);
+  all.push_back (NULL);
+
+  /* addi a0,a0,1; c.addi a0,1; lw a1,0(a0); jal ra,0; then
+     pseudo-random words.  */
+  std::vector<insn_t> words = { 0x00150513, 0x0505, 0x00052583, 0x000000ef };
+  for (int i = 0; i < 100000; i++)
+    {
+      seed = seed * 1103515245 + 12345;
+      insn_t word = seed ^ (seed >> 16);
+      if ((word & 0x3) != 0x3)
+	word &= 0xffff;
+      if (riscv_insn_length (word) <= 4)
+	words.push_back (word);
+    }
+
+  for (insn_t word : words)
+    {
+      const struct riscv_opcode **cand = riscv_decode_candidates (tree, word);
+      std::vector<const struct riscv_opcode *> expected
+	= riscv_matching_opcodes (all.data (), word);
+
+      if (cand == NULL)
+	SELF_CHECK (expected.empty ());
+      else
+	SELF_CHECK (riscv_matching_opcodes (cand, word) == expected);
+    }
+
+  riscv_free_decode_tree (tree);
+}
+
+/* gdb asks opcodes for the disassembler again before each instruction.
+   Check that disassembling through gdb_disassembler still decodes each
+   instruction.  */
+
+static void
+riscv_disassembler_tree_test ()
+{
+  struct gdbarch_info info;
+
+  info.bfd_arch_info = bfd_scan_arch ("riscv:rv64");
+
+  struct gdbarch *gdbarch = gdbarch_find_by_info (info);
+  SELF_CHECK (gdbarch != NULL);
+
+  /* addi a0,a0,1; c.addi a0,1; lw a1,0(a0); jal ra,0.  */
+  static const gdb_byte insns[] = {
+    0x13, 0x05, 0x15, 0x00,
+    0x05, 0x05,
+    0x83, 0x25, 0x05, 0x00,
+    0xef, 0x00, 0x00, 0x00,
+  };
+  riscv_buffer_disassembler di (gdbarch, insns);
+  int count = 0;
+
+  for (int pass = 0; pass < 16; pass++)
+    for (CORE_ADDR addr = 0; addr < sizeof (insns); count++)
+      addr += di.print_insn (addr);
+
+  SELF_CHECK (count == 64);
+}
+
+} /* namespace selftests */
+
+#endif /* GDB_SELF_TEST */
+
 void _initialize_riscv_tdep ();
 void
 _initialize_riscv_tdep ()
@@ -4072,6 +4431,13 @@ _initialize_riscv_tdep ()
 
   gdbarch_register (bfd_arch_riscv, riscv_gdbarch_init, NULL);
 
+#if GDB_SELF_TEST
+  selftests::register_test ("riscv-decode-tree",
+			    selftests::riscv_decode_tree_test);
+  selftests::register_test ("riscv-disassembler-tree",
+			    selftests::riscv_disassembler_tree_test);
+#endif
+
   /* Add root prefix command for all "set debug riscv" and "show debug
      riscv" commands.  */
   add_setshow_prefix_cmd ("riscv", no_class,
@@ -2815,6 +2815,10 @@ allocate_symtab (struct compunit_symtab *cust, const char *filename)
       cust->last_filetab = symtab;
     }
 
+  /* Any line index built so far does not cover the new symtab.  */
+  cust->m_line_index = NULL;
+  cust->m_line_index_size = 0;
+
   /* Backlink to the containing compunit symtab.  */
   symtab->compunit_symtab = cust;
 
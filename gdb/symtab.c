@@ -77,7 +77,7 @@
 
 static void rbreak_command (const char *, int);
 
-static int find_line_common (struct linetable *, int, int *, int);
+static int find_line_common (struct symtab *, int, int *, int);
 
 static struct block_symbol
   lookup_symbol_aux (const char *name,
@@ -359,6 +359,59 @@ compunit_symtab::set_call_site_htab (htab_t call_site_htab)
   m_call_site_htab = call_site_htab;
 }
 
+/* Return true if A sorts before B in a compunit's line index.  */
+
+static bool
+line_index_entry_less (const line_index_entry &a, const line_index_entry &b)
+{
+  if (a.symtab != b.symtab)
+    return std::less<const symtab *> () (a.symtab, b.symtab);
+  if (a.line != b.line)
+    return a.line < b.line;
+  return a.index < b.index;
+}
+
+/* See symtab.h.  */
+
+gdb::array_view<const line_index_entry>
+compunit_symtab::line_index (const struct symtab *symtab)
+{
+  if (m_line_index == nullptr)
+    {
+      std::vector<line_index_entry> entries;
+
+      for (struct symtab *s : compunit_filetabs (this))
+	{
+	  const struct linetable *l = SYMTAB_LINETABLE (s);
+
+	  if (l == nullptr)
+	    continue;
+	  for (int i = 0; i < l->nitems; i++)
+	    if (l->item[i].is_stmt && l->item[i].line != 0)
+	      entries.push_back ({s, l->item[i].line, i});
+	}
+      std::sort (entries.begin (), entries.end (), line_index_entry_less);
+
+      m_line_index = XOBNEWVEC (&objfile->objfile_obstack, line_index_entry,
+				entries.size ());
+      std::copy (entries.begin (), entries.end (), m_line_index);
+      m_line_index_size = entries.size ();
+    }
+
+  const line_index_entry *begin = m_line_index;
+  const line_index_entry *end = begin + m_line_index_size;
+  const line_index_entry *lo
+    = std::lower_bound (begin, end,
+			line_index_entry {symtab, INT_MIN, INT_MIN},
+			line_index_entry_less);
+  const line_index_entry *hi
+    = std::upper_bound (lo, end,
+			line_index_entry {symtab, INT_MAX, INT_MAX},
+			line_index_entry_less);
+
+  return gdb::array_view<const line_index_entry> (lo, hi);
+}
+
 /* See symtab.h.  */
 
 struct symtab *
@@ -3428,7 +3481,7 @@ find_line_symtab (struct symtab *sym_tab, int line,
   /* First try looking it up in the given symtab.  */
   best_linetable = SYMTAB_LINETABLE (sym_tab);
   best_symtab = sym_tab;
-  best_index = find_line_common (best_linetable, line, &exact, 0);
+  best_index = find_line_common (sym_tab, line, &exact, 0);
   if (best_index < 0 || !exact)
     {
       /* Didn't find an exact match.  So we better keep looking for
@@ -3466,7 +3519,7 @@ find_line_symtab (struct symtab *sym_tab, int line,
 				    symtab_to_fullname (s)) != 0)
 		    continue;	
 		  l = SYMTAB_LINETABLE (s);
-		  ind = find_line_common (l, line, &exact, 0);
+		  ind = find_line_common (s, line, &exact, 0);
 		  if (ind >= 0)
 		    {
 		      if (exact)
@@ -3508,34 +3561,37 @@ std::vector<CORE_ADDR>
 find_pcs_for_symtab_line (struct symtab *symtab, int line,
 			  struct linetable_entry **best_item)
 {
-  int start = 0;
   std::vector<CORE_ADDR> result;
+  int was_exact;
+  int idx;
 
-  /* First, collect all the PCs that are at this line.  */
-  while (1)
-    {
-      int was_exact;
-      int idx;
+  idx = find_line_common (symtab, line, &was_exact, 0);
+  if (idx < 0)
+    return result;
 
-      idx = find_line_common (SYMTAB_LINETABLE (symtab), line, &was_exact,
-			      start);
-      if (idx < 0)
-	break;
+  if (!was_exact)
+    {
+      struct linetable_entry *item = &SYMTAB_LINETABLE (symtab)->item[idx];
 
-      if (!was_exact)
-	{
-	  struct linetable_entry *item = &SYMTAB_LINETABLE (symtab)->item[idx];
+      if (*best_item == NULL
+	  || (item->line < (*best_item)->line && item->is_stmt))
+	*best_item = item;
 
-	  if (*best_item == NULL
-	      || (item->line < (*best_item)->line && item->is_stmt))
-	    *best_item = item;
+      return result;
+    }
 
-	  break;
-	}
+  /* Collect all the PCs that are at this line.  The compunit's line
+     index has their entries next to each other, in line table order,
+     starting with the one at IDX.  */
+  gdb::array_view<const line_index_entry> entries
+    = SYMTAB_COMPUNIT (symtab)->line_index (symtab);
+  const line_index_entry *it
+    = std::lower_bound (entries.begin (), entries.end (),
+			line_index_entry {symtab, line, idx},
+			line_index_entry_less);
 
-      result.push_back (SYMTAB_LINETABLE (symtab)->item[idx].pc);
-      start = idx + 1;
-    }
+  for (; it != entries.end () && it->line == line; ++it)
+    result.push_back (SYMTAB_LINETABLE (symtab)->item[it->index].pc);
 
   return result;
 }
@@ -3605,59 +3661,58 @@ find_line_pc_range (struct symtab_and_line sal, CORE_ADDR *startptr,
   return true;
 }
 
-/* Given a line table and a line number, return the index into the line
-   table for the pc of the nearest line whose number is >= the specified one.
-   Return -1 if none is found.  The value is >= 0 if it is an index.
-   START is the index at which to start searching the line table.
+/* Given a symtab and a line number, return the index into the symtab's
+   line table for the pc of the nearest line whose number is >= the
+   specified one.  Return -1 if none is found.  The value is >= 0 if it
+   is an index.  START is the index at which to start searching the
+   line table.
+
+   Set *EXACT_MATCH nonzero if the value returned is an exact match.
 
-   Set *EXACT_MATCH nonzero if the value returned is an exact match.  */
+   This uses the line index of the symtab's compunit rather than
+   scanning the line table, since setting many breakpoints by line
+   would otherwise scan the same tables over and over.  */
 
 static int
-find_line_common (struct linetable *l, int lineno,
+find_line_common (struct symtab *symtab, int lineno,
 		  int *exact_match, int start)
 {
-  int i;
-  int len;
-
-  /* BEST is the smallest linenumber > LINENO so far seen,
-     or 0 if none has been seen so far.
-     BEST_INDEX identifies the item for it.  */
-
-  int best_index = -1;
-  int best = 0;
-
   *exact_match = 0;
 
   if (lineno <= 0)
     return -1;
-  if (l == 0)
+  if (SYMTAB_LINETABLE (symtab) == NULL)
     return -1;
 
-  len = l->nitems;
-  for (i = start; i < len; i++)
-    {
-      struct linetable_entry *item = &(l->item[i]);
+  gdb::array_view<const line_index_entry> entries
+    = SYMTAB_COMPUNIT (symtab)->line_index (symtab);
+  const line_index_entry *end = entries.end ();
+  const line_index_entry *it
+    = std::lower_bound (entries.begin (), end,
+			line_index_entry {symtab, lineno, start},
+			line_index_entry_less);
 
-      /* Ignore non-statements.  */
-      if (!item->is_stmt)
-	continue;
+  if (it != end && it->line == lineno)
+    {
+      /* Return the first (lowest address) entry which matches.  */
+      *exact_match = 1;
+      return it->index;
+    }
 
-      if (item->line == lineno)
-	{
-	  /* Return the first (lowest address) entry which matches.  */
-	  *exact_match = 1;
-	  return i;
-	}
+  /* Otherwise IT is the first entry for a larger line.  Look for the
+     smallest line number > LINENO that has an entry at or after START,
+     and return the first such entry.  */
+  while (it != end)
+    {
+      if (it->index >= start)
+	return it->index;
 
-      if (item->line > lineno && (best == 0 || item->line < best))
-	{
-	  best = item->line;
-	  best_index = i;
-	}
+      it = std::lower_bound (it, end,
+			     line_index_entry {symtab, it->line, start},
+			     line_index_entry_less);
     }
 
-  /* If we got here, we didn't get an exact match.  */
-  return best_index;
+  return -1;
 }
 
 bool
@@ -25,6 +25,7 @@
 #include <string>
 #include <set>
 #include "gdbsupport/gdb_vecs.h"
+#include "gdbsupport/array-view.h"
 #include "gdbtypes.h"
 #include "gdbsupport/gdb_obstack.h"
 #include "gdbsupport/gdb_regex.h"
@@ -1412,6 +1413,21 @@ struct symtab
 #define SYMTAB_DIRNAME(symtab) \
   COMPUNIT_DIRNAME (SYMTAB_COMPUNIT (symtab))
 
+/* An entry in the line index of a compunit symtab: one statement
+   entry of the line table of one of its filetabs.  */
+
+struct line_index_entry
+{
+  /* The filetab whose line table holds the entry.  */
+  const struct symtab *symtab;
+
+  /* The entry's line number.  */
+  int line;
+
+  /* The position of the entry in the line table.  */
+  int index;
+};
+
 /* Compunit symtabs contain the actual "symbol table", aka blockvector, as well
    as the list of all source files (what gdb has historically associated with
    the term "symtab").
@@ -1455,6 +1471,12 @@ struct compunit_symtab
   /* Find call_site info for PC.  */
   call_site *find_call_site (CORE_ADDR pc) const;
 
+  /* Return the statement entries of the line table of SYMTAB, one of
+     this compunit's filetabs, sorted by line and then by position in
+     the table.  Entries for line 0 are left out.  */
+  gdb::array_view<const line_index_entry>
+    line_index (const struct symtab *symtab);
+
   /* Unordered chain of all compunit symtabs of this objfile.  */
   struct compunit_symtab *next;
 
@@ -1511,6 +1533,14 @@ struct compunit_symtab
   /* struct call_site entries for this compilation unit or NULL.  */
   htab_t m_call_site_htab;
 
+  /* The statement entries of the line tables of all the filetabs,
+     sorted by symtab, line and position in the table, so that a file
+     and line can be looked up without scanning the tables.  Built on
+     the objfile obstack by the first call to line_index, and NULL
+     until then.  */
+  struct line_index_entry *m_line_index;
+  int m_line_index_size;
+
   /* The macro table for this symtab.  Like the blockvector, this
      is shared between different symtabs in a given compilation unit.
      It's debatable whether it *should* be shared among all the symtabs in
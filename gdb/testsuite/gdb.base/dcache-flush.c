@@ -26,6 +26,7 @@ main ()
 {
   int var1 = 4;
   int var2 = 3;
+  char buf[4096] = { 0 };
   int res;
 
   res = func (&var1, &var2);
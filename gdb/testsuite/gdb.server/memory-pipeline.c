@@ -0,0 +1,43 @@
+/* This testcase is part of GDB, the GNU debugger.
+
+   Copyright 2022 Free Software Foundation, Inc.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+
+#define SIZE 65536
+
+/* Large enough that a transfer takes many packets.  */
+unsigned char buf[SIZE];
+unsigned char copy[SIZE];
+
+static void
+done (void)
+{
+}
+
+int
+main (void)
+{
+  unsigned int seed = 1;
+  int i;
+
+  for (i = 0; i < SIZE; i++)
+    {
+      seed = seed * 1103515245 + 12345;
+      buf[i] = seed >> 16;
+    }
+
+  done ();
+  return 0;
+}
@@ -208,4 +208,5 @@ m4_include([../config/lib-ld.m4])
 m4_include([../config/lib-link.m4])
 m4_include([../config/lib-prefix.m4])
 m4_include([../config/override.m4])
+m4_include([../config/zlib.m4])
 m4_include([acinclude.m4])
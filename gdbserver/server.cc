@@ -36,6 +36,7 @@
 #include "dll.h"
 #include "hostio.h"
 #include <vector>
+#include <zlib.h>
 #include "gdbsupport/common-inferior.h"
 #include "gdbsupport/job-control.h"
 #include "gdbsupport/environ.h"
@@ -50,6 +51,7 @@
 #include "gdbsupport/gdb_select.h"
 #include "gdbsupport/scoped_restore.h"
 #include "gdbsupport/search.h"
+#include "gdbsupport/byte-vector.h"
 
 #define require_running_or_return(BUF)		\
   if (!target_running ())			\
@@ -2530,6 +2532,13 @@ handle_query (char *own_buf, int packet_len, int *new_packet_len_p)
       if (target_supports_memory_tagging ())
 	strcat (own_buf, ";memory-tagging+");
 
+      /* Packets that arrive while one is being handled stay in the
+	 readchar buffer and are handled in order afterwards, so GDB
+	 may send several memory packets before reading the replies.  */
+      strcat (own_buf, ";memory-pipelining+");
+
+      strcat (own_buf, ";vZRead+;vZWrite+");
+
       /* Reinitialize components as needed for the new connection.  */
       hostio_handle_new_gdb_connection ();
       target_handle_new_gdb_connection ();
@@ -3158,6 +3167,103 @@ handle_v_kill (char *own_buf)
     write_enn (own_buf);
 }
 
+/* The most bytes that a vZRead or vZWrite packet may transfer.  */
+#define ZMEM_MAX_BYTES 0x10000
+
+/* Handle a "vZRead:ADDR,LENGTH" packet.  Reply with 'Z' and the
+   escaped zlib stream for as much of the range as compresses into a
+   single packet.  */
+
+static void
+handle_vZRead (char *own_buf, int *new_packet_len)
+{
+  CORE_ADDR addr;
+  unsigned int len;
+  int res;
+
+  decode_m_packet (own_buf + strlen ("vZRead:"), &addr, &len);
+  len = std::min (len, (unsigned int) ZMEM_MAX_BYTES);
+
+  gdb::byte_vector mem (len);
+  res = gdb_read_memory (addr, mem.data (), len);
+  if (res <= 0)
+    {
+      write_enn (own_buf);
+      return;
+    }
+
+  gdb::byte_vector zbuf (compressBound (res));
+  while (true)
+    {
+      uLongf zlen = zbuf.size ();
+      int escaped_bytes;
+      int out_len;
+
+      if (compress2 (zbuf.data (), &zlen, mem.data (), res,
+		     Z_DEFAULT_COMPRESSION) != Z_OK)
+	{
+	  write_enn (own_buf);
+	  return;
+	}
+
+      own_buf[0] = 'Z';
+      out_len = remote_escape_output (zbuf.data (), zlen, 1,
+				      (gdb_byte *) own_buf + 1,
+				      &escaped_bytes, PBUFSIZ - 2);
+      if ((uLongf) escaped_bytes == zlen)
+	{
+	  *new_packet_len = out_len + 1;
+	  return;
+	}
+
+      /* The stream does not fit; send less of the range, in
+	 proportion to the part that did.  */
+      if (res == 1)
+	{
+	  write_enn (own_buf);
+	  return;
+	}
+      res = std::max (1, std::min (res / 2,
+				   (int) ((uLongf) res * escaped_bytes / zlen
+					  * 7 / 8)));
+    }
+}
+
+/* Handle a "vZWrite:ADDR,LENGTH:DATA" packet, where DATA is the
+   escaped zlib stream for the LENGTH bytes to write.  */
+
+static void
+handle_vZWrite (char *own_buf, int packet_len)
+{
+  CORE_ADDR addr;
+  unsigned int len;
+  const char *p;
+  int zlen;
+  uLongf mem_len;
+
+  p = decode_m_packet_params (own_buf + strlen ("vZWrite:"), &addr, &len,
+			      ':');
+  if (len > ZMEM_MAX_BYTES)
+    {
+      write_enn (own_buf);
+      return;
+    }
+
+  gdb::byte_vector zbuf (packet_len);
+  zlen = remote_unescape_input ((const gdb_byte *) p,
+				packet_len - (p - own_buf),
+				zbuf.data (), zbuf.size ());
+
+  gdb::byte_vector mem (len);
+  mem_len = len;
+  if (uncompress (mem.data (), &mem_len, zbuf.data (), zlen) != Z_OK
+      || mem_len != len
+      || gdb_write_memory (addr, mem.data (), len) != 0)
+    write_enn (own_buf);
+  else
+    write_ok (own_buf);
+}
+
 /* Handle all of the extended 'v' packets.  */
 void
 handle_v_requests (char *own_buf, int packet_len, int *new_packet_len)
@@ -3232,6 +3338,20 @@ handle_v_requests (char *own_buf, int packet_len, int *new_packet_len)
       return;
     }
 
+  if (startswith (own_buf, "vZRead:"))
+    {
+      require_running_or_return (own_buf);
+      handle_vZRead (own_buf, new_packet_len);
+      return;
+    }
+
+  if (startswith (own_buf, "vZWrite:"))
+    {
+      require_running_or_return (own_buf);
+      handle_vZWrite (own_buf, packet_len);
+      return;
+    }
+
   if (startswith (own_buf, "vKill;"))
     {
       if (!target_running ())
@@ -546,6 +546,10 @@ struct bfd_link_info
   /* Compress DWARF debug sections.  */
   enum compressed_debug_section_type compress_debug;
 
+  /* The zlib level to compress DWARF debug sections with, from 1 to 9,
+     or 0 for the zlib default.  */
+  int compress_debug_level;
+
   /* Default stack size.  Zero means default (often zero itself), -1
      means explicitly zero-sized.  */
   bfd_signed_vma stacksize;
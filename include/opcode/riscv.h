@@ -25,6 +25,10 @@
 #include <stdlib.h>
 #include <stdint.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 typedef uint64_t insn_t;
 
 static inline unsigned int riscv_insn_length (insn_t insn)
@@ -773,4 +777,39 @@ extern const char * const riscv_vma[2];
 extern const struct riscv_opcode riscv_opcodes[];
 extern const struct riscv_opcode riscv_insn_types[];
 
+/* A decode tree over one or more opcode tables.  Inner nodes dispatch on
+   the instruction bits (INSN >> SHIFT) & ((1 << WIDTH) - 1); leaves hold
+   the NULL-terminated list of candidate opcodes in table order.  */
+struct riscv_decode_node
+{
+  unsigned int shift;
+  unsigned int width;
+  struct riscv_decode_node *children;
+  const struct riscv_opcode **ops;
+};
+
+/* Return nonzero if OP should be kept in a decode tree.  */
+typedef int (*riscv_decode_filter_t) (const struct riscv_opcode *op,
+				      void *data);
+
+extern struct riscv_decode_node *riscv_build_decode_tree
+  (const struct riscv_opcode *const *, riscv_decode_filter_t, void *);
+extern void riscv_free_decode_tree (struct riscv_decode_node *);
+
+/* Return the candidate opcodes for INSN in TREE, or NULL if no table
+   has any entry for its major opcode.  */
+
+static inline const struct riscv_opcode **
+riscv_decode_candidates (const struct riscv_decode_node *tree, insn_t insn)
+{
+  while (tree->children != NULL)
+    tree = &tree->children[(insn >> tree->shift)
+			   & ((1u << tree->width) - 1)];
+  return tree->ops;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* _RISCV_H_ */
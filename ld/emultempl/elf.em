@@ -635,17 +635,39 @@ gld${EMULATION_NAME}_handle_option (int optc)
       break;
 
     case OPTION_COMPRESS_DEBUG:
-      if (strcasecmp (optarg, "none") == 0)
-	link_info.compress_debug = COMPRESS_DEBUG_NONE;
-      else if (strcasecmp (optarg, "zlib") == 0)
-	link_info.compress_debug = COMPRESS_DEBUG_GABI_ZLIB;
-      else if (strcasecmp (optarg, "zlib-gnu") == 0)
-	link_info.compress_debug = COMPRESS_DEBUG_GNU_ZLIB;
-      else if (strcasecmp (optarg, "zlib-gabi") == 0)
-	link_info.compress_debug = COMPRESS_DEBUG_GABI_ZLIB;
-      else
-	einfo (_("%F%P: invalid --compress-debug-sections option: \`%s'\n"),
-	       optarg);
+      {
+	char *type = xstrdup (optarg);
+	char *level = strchr (type, ',');
+
+	if (level != NULL)
+	  *level++ = '\0';
+	if (strcasecmp (type, "none") == 0)
+	  link_info.compress_debug = COMPRESS_DEBUG_NONE;
+	else if (strcasecmp (type, "zlib") == 0)
+	  link_info.compress_debug = COMPRESS_DEBUG_GABI_ZLIB;
+	else if (strcasecmp (type, "zlib-gnu") == 0)
+	  link_info.compress_debug = COMPRESS_DEBUG_GNU_ZLIB;
+	else if (strcasecmp (type, "zlib-gabi") == 0)
+	  link_info.compress_debug = COMPRESS_DEBUG_GABI_ZLIB;
+	else
+	  einfo (_("%F%P: invalid --compress-debug-sections option: \`%s'\n"),
+		 optarg);
+
+	/* A lower zlib level trades size for link time.  */
+	if (level != NULL)
+	  {
+	    char *end = level;
+	    long n = -1;
+
+	    if (startswith (level, "level="))
+	      n = strtol (level + 6, &end, 10);
+	    if (n < 1 || n > 9 || *end != '\0')
+	      einfo (_("%F%P: invalid --compress-debug-sections option: \`%s'\n"),
+		     optarg);
+	    link_info.compress_debug_level = n;
+	  }
+	free (type);
+      }
       break;
 EOF
 
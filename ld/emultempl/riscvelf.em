@@ -51,9 +51,11 @@ static andes_ld_options_t andes =
   .set_relax_tls_le = 1,
   .set_relax_cross_section_call = $D4_RCSC,
   .set_workaround = 1,
+  .set_relax_defer_delete = 1,
   /* exec.it options  */
   .execit_import_file = NULL,
   .execit_export_file = NULL,
+  .execit_cache_file = NULL,
   .target_optimization = 0,
   .execit_limit = -1, /* default */
   .execit_auipc_entry = 2, /* 2 for worst cases. (b28185)  */
@@ -62,6 +64,7 @@ static andes_ld_options_t andes =
   .keep_import_execit = 0,
   .execit_loop_aware = 0,
   .execit_jal_over_2m = 0,
+  .table_jump_stats = 0,
   /* andes internal options.  */
   .set_table_jump = 0,
   .set_table_jump_cli = 0,
@@ -345,6 +348,8 @@ PARSE_AND_LIST_PROLOGUE='
 #define OPTION_RELAX_CROSS_SECTION_CALL	(OPTION_INTERNAL_BASELINE + 11)
 #define OPTION_NO_RELAX_CROSS_SECTION_CALL	(OPTION_INTERNAL_BASELINE + 12)
 #define OPTION_NO_WORKAROUND		(OPTION_INTERNAL_BASELINE + 13)
+#define OPTION_NO_RELAX_DEFER_DELETE	(OPTION_INTERNAL_BASELINE + 14)
+#define OPTION_TABLE_JUMP_STATS		(OPTION_INTERNAL_BASELINE + 15)
 
 /* These are only available for Andes internal options.  */
 #if defined RISCV_ANDES_INTERNAL_OPTIONS
@@ -383,6 +388,7 @@ PARSE_AND_LIST_PROLOGUE='
 #define OPTION_NO_EXECIT_RVP		(OPTION_EXECIT_BASELINE + 26)
 #define OPTION_NEXECIT_OP		(OPTION_EXECIT_BASELINE + 27)
 #define OPTION_EXECIT_AUIPC_ENTRY		(OPTION_EXECIT_BASELINE + 28)
+#define OPTION_EXECIT_CACHE		(OPTION_EXECIT_BASELINE + 29)
 #endif
 
 /* These are only for lld internal usage and not affected for bfd.  */
@@ -416,6 +422,8 @@ PARSE_AND_LIST_LONGOPTS='
   { "mrelax-cross-section-call", no_argument, NULL, OPTION_RELAX_CROSS_SECTION_CALL},
   { "mno-relax-cross-section-call", no_argument, NULL, OPTION_NO_RELAX_CROSS_SECTION_CALL},
   { "mno-workaround", no_argument, NULL, OPTION_NO_WORKAROUND},
+  { "mno-relax-defer-delete", no_argument, NULL, OPTION_NO_RELAX_DEFER_DELETE},
+  { "mtable-jump-stats", no_argument, NULL, OPTION_TABLE_JUMP_STATS},
 
 /* These are specific options for EXECIT support.  */
 #if defined RISCV_ANDES_INTERNAL_OPTIONS
@@ -452,6 +460,7 @@ PARSE_AND_LIST_LONGOPTS='
   { "mno-execit-xdsp", no_argument, NULL, OPTION_NO_EXECIT_XDSP},
   { "mnexecitop", no_argument, NULL, OPTION_NEXECIT_OP},
   { "mexecit-auipc-entry", required_argument, NULL, OPTION_EXECIT_AUIPC_ENTRY},
+  { "mexecit-cache", required_argument, NULL, OPTION_EXECIT_CACHE},
   /* Obsolete options for EXECIT.  */
   { "mex9", no_argument, NULL, OPTION_EX9_TABLE},
   { "mno-ex9", no_argument, NULL, OPTION_NO_EXECIT_TABLE},
@@ -482,6 +491,7 @@ fprintf (file, _("\
     --mexport-symbols=FILE      Exporting global symbols into linker script\n\
     --m[no-]relax-cross-section-call Disable/enable cross-section relaxations\n\
     --mno-workaround            Disable all workarounds\n\
+    --mtable-jump-stats         Report the benefit of each table jump entry\n\
 "));
 
 #if defined RISCV_EXECIT_EXT
@@ -489,6 +499,7 @@ fprintf (file, _("\
     --m[no-]execit              Disable/enable link-time EXECIT relaxation\n\
     --mexport-execit=FILE       Export .exec.itable after linking\n\
     --mimport-execit=FILE       Import .exec.itable for EXECIT relaxation\n\
+    --mexecit-cache=FILE        Reuse the EXECIT scans of unchanged sections\n\
     --mkeep-import-execit       Keep imported .exec.itable\n\
     --mupdate-execit            Update existing .exec.itable\n\
     --mexecit-limit=NUM         Set maximum number of entries in .exec.itable for this times\n\
@@ -565,6 +576,12 @@ PARSE_AND_LIST_ARGS_CASES='
   case OPTION_NO_WORKAROUND:
     andes.set_workaround = 0;
     break;
+  case OPTION_NO_RELAX_DEFER_DELETE:
+    andes.set_relax_defer_delete = 0;
+    break;
+  case OPTION_TABLE_JUMP_STATS:
+    andes.table_jump_stats = 1;
+    break;
 
 #if defined RISCV_ANDES_INTERNAL_OPTIONS
   case OPTION_OPT_TABLE_JUMP:
@@ -604,6 +621,13 @@ PARSE_AND_LIST_ARGS_CASES='
     if(andes.execit_import_file == NULL)
       einfo (_("ERROR %P%F: cannot open execit import file %s.\n"), optarg);
     break;
+  case OPTION_EXECIT_CACHE:
+    if (!optarg)
+      einfo (_("Missing file for --mexecit-cache=<file>.\n"));
+
+    andes.execit_cache_file = optarg;
+    /* Read and written by the EXECIT relaxation.  */
+    break;
   case OPTION_KEEP_IMPORT_EXECIT:
     andes.keep_import_execit = 1;
     break;
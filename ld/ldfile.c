@@ -147,6 +147,9 @@ ldfile_try_open_bfd (const char *attempt,
   /* Linker needs to decompress sections.  */
   entry->the_bfd->flags |= BFD_DECOMPRESS;
 
+  /* Input relocs are only read, so large ones can be mapped.  */
+  entry->the_bfd->flags |= BFD_MMAP_CONTENTS;
+
   /* This is a linker input BFD.  */
   entry->the_bfd->is_linker_input = 1;
 
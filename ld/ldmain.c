@@ -508,6 +508,7 @@ main (int argc, char **argv)
       link_info.output_bfd->flags |= BFD_COMPRESS;
       if (link_info.compress_debug == COMPRESS_DEBUG_GABI_ZLIB)
 	link_info.output_bfd->flags |= BFD_COMPRESS_GABI;
+      link_info.output_bfd->compress_level = link_info.compress_debug_level;
     }
 
   ldwrite ();
@@ -0,0 +1,13 @@
+	.option execit
+	.text
+	.globl	_start
+_start:
+	la	a0, _ITB_BASE_
+	csrrw	x0, uitb, a0
+	addi	a0, a0, 100
+	addi	a1, a1, 200
+	addi	a0, a0, 100
+	addi	a1, a1, 200
+	lui	a2, 0x12345
+	lui	a2, 0x12345
+	ret
@@ -0,0 +1,9 @@
+	.option execit
+	.text
+	.globl	foo
+foo:
+	addi	a0, a0, 100
+	add	a3, a4, a5
+	.insn	i 0x13, 0, x0, x0, 0
+	add	a3, a4, a5
+	ret
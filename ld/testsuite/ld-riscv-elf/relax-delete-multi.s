@@ -0,0 +1,37 @@
+	.text
+	.globl	_start
+	.type	_start, @function
+_start:
+	call	foo
+	call	foo
+	call	bar
+	.size	_start, .-_start
+	.globl	mid
+	.type	mid, @function
+mid:
+	addi	a0, a0, 1
+.Lin:
+	call	foo
+	call	foo
+	addi	a0, a0, 2
+	call	.Lin
+	.size	mid, .-mid
+	.globl	load
+	.type	load, @function
+load:
+	lui	a1, %hi(data_g)
+	addi	a1, a1, %lo(data_g)
+	call	load
+	.size	load, .-load
+	.globl	bar
+bar:
+	call	mid
+	call	_start
+foo:
+	ret
+
+	.section .sdata,"aw"
+	.space	16
+	.globl	data_g
+data_g:
+	.word	1
@@ -0,0 +1,30 @@
+	.text
+	.globl	_start
+_start:
+	call	fb
+	call	fa
+	call	fb
+	call	fa
+	.rept	4
+	call	fc
+	.endr
+	tail	fe
+	.rept	2
+	tail	fd
+	.endr
+	.rept	2
+	tail	fe
+	.endr
+	tail	fd
+
+	.section .far, "ax"
+	.globl	fa
+fa:	ret
+	.globl	fb
+fb:	ret
+	.globl	fc
+fc:	ret
+	.globl	fd
+fd:	ret
+	.globl	fe
+fe:	ret
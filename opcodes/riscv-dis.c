@@ -54,6 +54,20 @@ static riscv_parse_subset_t riscv_rps_dis =
   false,		/* exec.it enabled?  */
 };
 
+/* A $x or $d mapping symbol.  */
+
+struct riscv_map_symbol
+{
+  bfd_vma addr;
+  int index;
+  enum riscv_seg_mstate state;
+};
+
+/* The state kept for each disassemble_info.  The decode tree, the
+   subsets, xlen, the options and the register name tables below are
+   still shared by every disassemble_info, so disassembling from several
+   threads at once is not safe.  */
+
 struct riscv_private_data
 {
   bfd_vma gp;
@@ -67,17 +81,21 @@ struct riscv_private_data
 #define FLAG_EXECIT_TAB  (1u << 1)
   bfd_vma flags;
   /* } Andes */
+
+  /* The section holding the exec.it table and the table's offset in
+     it, found on the first exec.it; (asection *) -1 if there is none.  */
+  asection *execit_section;
+  bfd_vma execit_bias;
+
+  /* The mapping symbols of MAP_SECTION, sorted by address.  */
+  bool map_valid;
+  asection *map_section;
+  struct riscv_map_symbol *map_syms;
+  int map_count;
 };
 
 typedef struct riscv_private_data private_data_t;
 
-/* Used for mapping symbols.  */
-static int last_map_symbol = -1;
-static bfd_vma last_stop_offset = 0;
-static bfd_vma last_map_symbol_boundary = 0;
-static enum riscv_seg_mstate last_map_state = MAP_NONE;
-static asection *last_map_section = NULL;
-
 static const char * const *riscv_gpr_names;
 static const char * const *riscv_fpr_names;
 
@@ -113,13 +131,13 @@ riscv_disassemble_insn (bfd_vma memaddr, insn_t word, disassemble_info *info);
 static bool
 andes_find_op_of_subset (has_subset_fun_t has_subset,
 			 int no_aliases_p,
-			 const struct riscv_opcode **hash,
+			 const struct riscv_opcode **cand,
 			 insn_t word,
-			 const struct riscv_opcode **pop);
+			 const struct riscv_opcode ***pcand);
 static bool
 andes_find_op_name_match (const char *mne,
 			  insn_t match,
-			  const riscv_opcode_t **hash,
+			  const riscv_opcode_t *table,
 			  const riscv_opcode_t **pop);
 
 /* Test if the op is favorite one.  */
@@ -149,11 +167,10 @@ riscv_execit_info (bfd_vma pc ATTRIBUTE_UNUSED,
 		   disassemble_info *info, uint32_t execit_index)
 {
   uint32_t insn;
-  static asection *section = NULL;
-  static bfd_vma bias = 0;
   bfd_byte buffer[4];
   int insnlen;
   private_data_t *pd = info->private_data;
+  asection *section = pd->execit_section;
   bfd_vma keep;
 
   /* If no section info can be related to this exec.it insn, this may be just
@@ -174,7 +191,7 @@ riscv_execit_info (bfd_vma pc ATTRIBUTE_UNUSED,
 	      if (0 == strcmp ("_ITB_BASE_", info->symtab[i]->name))
 		{
 		  section = info->symtab[i]->section;
-		  bias = info->symtab[i]->value;
+		  pd->execit_bias = info->symtab[i]->value;
 		  break;
 		}
 	    }
@@ -183,6 +200,7 @@ riscv_execit_info (bfd_vma pc ATTRIBUTE_UNUSED,
       /* Lookup it only once, in case .exec.itable doesn't exist at all.  */
       if (section == NULL)
 	section = (void *) -1;
+      pd->execit_section = section;
     }
 
   if (section == (void *) -1)
@@ -192,7 +210,7 @@ riscv_execit_info (bfd_vma pc ATTRIBUTE_UNUSED,
     return;
 
   bfd_get_section_contents (section->owner, section, buffer,
-			    execit_index * 4 + bias, 4);
+			    execit_index * 4 + pd->execit_bias, 4);
   insn = bfd_get_32 (section->owner, buffer);
   insnlen = riscv_insn_length (insn);
 
@@ -227,6 +245,117 @@ static void
 print_ace_args (const char **args, insn_t l, disassemble_info * info);
 /* } Andes ACE */
 
+/* The decode tree for the current subsets, rebuilt whenever they change.
+   RISCV_DIS_TREE_KEY describes the subsets it was built for, and
+   RISCV_DIS_SUBSETS_CHANGED is set when they may have changed since.  */
+
+static struct riscv_decode_node *riscv_dis_tree;
+static char *riscv_dis_tree_key;
+static bool riscv_dis_subsets_changed;
+static args_t riscv_dis_args;
+
+/* The entry where RVC decoding starts; see riscv_disassemble_insn.  */
+
+static const struct riscv_opcode *riscv_dis_rvc_start;
+
+/* Drop the opcodes that can never be printed with the current subsets
+   while building the decode tree, instead of checking every word.  */
+
+static int
+riscv_dis_keep_op (const struct riscv_opcode *op, void *data)
+{
+  args_t *args = data;
+
+  if (!riscv_multi_subset_supports (&riscv_rps_dis, op->insn_class))
+    return 0;
+
+  if (!is_preferred_subset (op, args))
+    return 0;
+
+  /* pick nexec.it if support xnexecit.  */
+  if ((args->has_xnexecit || args->has_zcb)
+      && ((0 == strcmp (op->name, "exec.it"))
+	  || (0 == strcmp (op->name, "ex9.it"))))
+    return 0;
+
+  /* prefer cm.* if support zcm*.  */
+  if (args->has_zcm && 0 == strncmp (op->name, "c.f", 3))
+    return 0;
+
+  return 1;
+}
+
+static void
+riscv_dis_build_tree (void)
+{
+  const struct riscv_opcode *tables[] = { riscv_opcodes, NULL, NULL };
+  args_t *args = &riscv_dis_args;
+
+  /* { Andes ACE */
+  /* ACE opcodes decode the major opcodes riscv_opcodes leaves free.  */
+  if (ace_lib_load_success && ace_opcs != NULL && ace_ops != NULL)
+    tables[1] = ace_opcs;
+  /* } Andes ACE */
+
+  /* { Andes */
+  args->has_c = riscv_multi_subset_supports (&riscv_rps_dis, INSN_CLASS_C);
+  args->has_p = riscv_subset_supports (&riscv_rps_dis, "p");
+  args->has_zcb = riscv_subset_supports_fuzzy (&riscv_rps_dis, "zcb");
+  args->has_zcm = riscv_subset_supports_fuzzy (&riscv_rps_dis, "zcm");
+  args->has_xnexecit = riscv_subset_supports (&riscv_rps_dis, "xnexecit");
+
+  riscv_dis_rvc_start = NULL;
+  andes_find_op_name_match ("c.unimp", 0, riscv_opcodes,
+			    &riscv_dis_rvc_start);
+  /* } Andes */
+
+  riscv_dis_tree = riscv_build_decode_tree (tables, riscv_dis_keep_op, args);
+}
+
+/* Return a description of the current subsets, xlen and privileged
+   spec, which the caller must free.  Unlike riscv_arch_str, this keeps
+   the subsets of unknown version added by the _patch-arch option.  */
+
+static char *
+riscv_dis_subsets_key (void)
+{
+  riscv_subset_t *subset;
+  size_t len = 32;
+  char *key, *p;
+
+  for (subset = riscv_subsets.head; subset != NULL; subset = subset->next)
+    len += strlen (subset->name) + 32;
+
+  key = xmalloc (len);
+  p = key + sprintf (key, "rv%u:%d", xlen, (int) default_priv_spec);
+  for (subset = riscv_subsets.head; subset != NULL; subset = subset->next)
+    p += sprintf (p, "_%s%dp%d", subset->name, subset->major_version,
+		  subset->minor_version);
+  return key;
+}
+
+/* Make sure the decode tree matches the current subsets.  gdb asks for
+   the disassembler again before each instruction, which parses the
+   architecture again, so only rebuild the tree if the result differs.  */
+
+static void
+riscv_dis_update_tree (void)
+{
+  char *key = riscv_dis_subsets_key ();
+
+  riscv_dis_subsets_changed = false;
+  if (riscv_dis_tree != NULL && strcmp (key, riscv_dis_tree_key) == 0)
+    {
+      free (key);
+      return;
+    }
+
+  riscv_free_decode_tree (riscv_dis_tree);
+  free (riscv_dis_tree_key);
+  riscv_dis_tree_key = key;
+  riscv_dis_build_tree ();
+}
+
 static void
 set_default_riscv_dis_options (void)
 {
@@ -261,6 +390,173 @@ parse_riscv_dis_option_without_args (const char *option)
   return true;
 }
 
+/* The compiled operand fields of all the ACE opcodes, by the address of
+   their 'X' in the opcode args.  */
+static htab_t ace_field_hash;
+
+static hashval_t
+ace_field_hash_hash (const void *entry)
+{
+  const ace_field_t *f = entry;
+  return htab_hash_pointer (f->arg);
+}
+
+static int
+ace_field_hash_eq (const void *entry1, const void *entry2)
+{
+  const ace_field_t *f1 = entry1, *f2 = entry2;
+  return f1->arg == f2->arg;
+}
+
+/* Compile the ACE operand field at ARG, an 'X' in the args of an ACE
+   opcode, so that it is looked up and parsed only once.  */
+
+static ace_field_t *
+ace_compile_field (const char *arg)
+{
+  const char *name = arg + 1;
+  const char *end = name + strcspn (name, ",");
+  const char *bar = memchr (name, '|', end - name);
+  size_t len = (bar != NULL ? bar : end) - name;
+  unsigned int i, maxparts = 0;
+  const char *p;
+  ace_field_t *f;
+
+  /* A discrete field has one more part than '|'.  */
+  if (bar != NULL)
+    for (maxparts = 1, p = bar; p < end; p++)
+      if (*p == '|')
+	maxparts++;
+  f = xcalloc (1, sizeof (*f) + maxparts * sizeof (f->parts[0]));
+
+  f->arg = arg;
+  f->end = end;
+  for (i = 0; ace_ops[i].name; i++)
+    if (strncmp (ace_ops[i].name, name, len) == 0
+	&& ace_ops[i].name[len] == '\0')
+      {
+	f->op = &ace_ops[i];
+	break;
+      }
+
+  /* With rGPR encoding format, operand bit-field may be discrete.
+     There is an "|" token in discrete format.  */
+  if (bar != NULL
+      && f->op != NULL
+      && (f->op->hw_res == HW_UINT || f->op->hw_res == HW_ACR))
+    {
+      const char *prefix = f->op->hw_res == HW_UINT ? "imm" : f->op->hw_name;
+
+      p = name + strlen (prefix);
+      while (p < end && f->nparts < maxparts)
+	{
+	  char *q;
+	  f->parts[f->nparts].msb = strtoul (p, &q, 10);
+	  f->parts[f->nparts].width = strtoul (q + 1, &q, 10);
+	  f->nparts++;
+	  p = q + 1;
+	}
+    }
+  return f;
+}
+
+/* Compile the operand fields of all the ACE opcodes.  */
+
+static void
+ace_compile_fields (void)
+{
+  const struct riscv_opcode *op;
+
+  if (ace_field_hash != NULL)
+    htab_empty (ace_field_hash);
+  else
+    ace_field_hash = htab_create_alloc (256, ace_field_hash_hash,
+					ace_field_hash_eq, free,
+					xcalloc, free);
+
+  for (op = ace_opcs; op->name; op++)
+    {
+      const char *arg;
+      for (arg = op->args; *arg; arg++)
+	if (*arg == 'X')
+	  {
+	    ace_field_t *f = ace_compile_field (arg);
+	    void **slot = htab_find_slot (ace_field_hash, f, INSERT);
+	    if (*slot != NULL)
+	      free (*slot);
+	    *slot = f;
+	    arg = f->end - 1;
+	  }
+    }
+}
+
+/* Return the compiled ACE operand field at ARG.  */
+
+const ace_field_t *
+andes_ace_field (const char *arg)
+{
+  ace_field_t key;
+
+  if (ace_field_hash == NULL)
+    return NULL;
+  key.arg = arg;
+  return htab_find (ace_field_hash, &key);
+}
+
+/* Return the value of the ACE operand FIELD in INSN.  */
+
+unsigned int
+andes_ace_extract (const ace_field_t *field, uint64_t insn)
+{
+  unsigned int bit_value = insn;
+  unsigned int i, ret = 0, width_acc = 0;
+
+  if (field->nparts == 0)
+    {
+      bit_value <<= 32 - (field->op->bitpos + 1);
+      bit_value >>= 32 - field->op->bitsize;
+      return bit_value;
+    }
+
+  for (i = 0; i < field->nparts; i++)
+    {
+      unsigned int val = (unsigned int) insn << (32 - field->parts[i].msb - 1);
+      val >>= 32 - field->parts[i].width;
+      ret |= val << width_acc;
+      width_acc += field->parts[i].width;
+    }
+  return ret;
+}
+
+/* Return the bits encoding VALUE in the ACE operand FIELD.  */
+
+uint64_t
+andes_ace_insert (const ace_field_t *field, unsigned int value)
+{
+  unsigned int bit_value;
+  unsigned int i, width_acc = 0;
+  uint64_t ret = 0;
+
+  if (field->nparts == 0)
+    {
+      /* Perform mask to truncate oversize value.  */
+      bit_value = value << (32 - field->op->bitsize);
+      bit_value >>= 32 - field->op->bitsize;
+      /* Shift value to specified position.  */
+      return bit_value << (field->op->bitpos - field->op->bitsize + 1);
+    }
+
+  for (i = 0; i < field->nparts; i++)
+    {
+      bit_value = value >> width_acc;
+      bit_value <<= 32 - field->parts[i].width;
+      bit_value >>= 32 - field->parts[i].width;
+      ret |= bit_value << (field->parts[i].msb - field->parts[i].width + 1);
+      width_acc += field->parts[i].width;
+    }
+  return ret;
+}
+
 /* Note: sub andes_ace_load_hooks is shared between gas and gdb
 	  without a common header file. */
 
@@ -288,7 +584,12 @@ char *andes_ace_load_hooks (const char *arg)
     }
 
   if (err == NULL)
-    ace_lib_load_success = true;
+    {
+      ace_lib_load_success = true;
+      ace_compile_fields ();
+      riscv_free_decode_tree (riscv_dis_tree);
+      riscv_dis_tree = NULL;
+    }
 
   return err;
 }
@@ -362,6 +663,7 @@ parse_riscv_dis_option (const char *option)
 	    *p = 0;
 	  riscv_parse_add_subset (&riscv_rps_dis, value,
 		RISCV_UNKNOWN_VERSION, RISCV_UNKNOWN_VERSION, false);
+	  riscv_dis_subsets_changed = true;
 	  value = p ? p + 1 : p;
 	}
     }
@@ -1095,115 +1397,90 @@ print_insn_args (const char *oparg, insn_t l, bfd_vma pc, disassemble_info *info
     }
 }
 
-/* Print the RISC-V instruction at address MEMADDR in debugged memory,
-   on using INFO.  Returns length of the instruction, in bytes.
-   BIGENDIAN must be 1 if this is big-endian code, 0 if
-   this is little-endian code.  */
+/* Set up the private data of INFO the first time it is used.  */
 
-static int
-riscv_disassemble_insn (bfd_vma memaddr, insn_t word, disassemble_info *info)
+static void
+riscv_init_private_data (struct disassemble_info *info)
 {
-  const struct riscv_opcode *op;
-  static bool init = 0;
-  static const struct riscv_opcode *riscv_hash[OP_MASK_OP + 1];
-  struct riscv_private_data *pd;
-  int insnlen;
-  static args_t args; /* Andes */
+  private_data_t *pd;
+  const bfd_vma minus = (bfd_vma) -1;
+  int i;
+  bfd_vma sym_val;
 
-#define OP_HASH_IDX(i) ((i) & (riscv_insn_length (i) == 2 ? 0x3 : OP_MASK_OP))
+  pd = info->private_data = xcalloc (1, sizeof (struct riscv_private_data));
+  pd->gp = minus;
+  pd->print_addr = minus;
+  pd->jvt_base = minus;
+  pd->jvt_end = minus;
 
-  /* Build a hash table to shorten the search time.  */
-  if (! init)
-    {
-      for (op = riscv_opcodes; op->name; op++)
-	if (!riscv_hash[OP_HASH_IDX (op->match)])
-	  riscv_hash[OP_HASH_IDX (op->match)] = op;
+  for (i = 0; i < (int)ARRAY_SIZE (pd->hi_addr); i++)
+    pd->hi_addr[i] = minus;
 
-      /* { Andes ACE */
-      /* Insert ACE opcode attributes into hash table if exist */
-      if (ace_lib_load_success && ace_opcs != NULL && ace_ops != NULL)
-	{
-	  for (op = ace_opcs; op->name; op++)
-	    if (!riscv_hash[OP_HASH_IDX (op->match)])
-	      riscv_hash[OP_HASH_IDX (op->match)] = op;
-	}
-      /* } Andes ACE */
-
-      /* { Andes */
-      args.has_c = riscv_multi_subset_supports (&riscv_rps_dis, INSN_CLASS_C);
-      args.has_p = riscv_subset_supports (&riscv_rps_dis, "p");
-      args.has_zcb = riscv_subset_supports_fuzzy (&riscv_rps_dis, "zcb");
-      args.has_zcm = riscv_subset_supports_fuzzy (&riscv_rps_dis, "zcm");
-      args.has_xnexecit = riscv_subset_supports (&riscv_rps_dis, "xnexecit");
-      /* } Andes */
-
-      init = 1;
+  for (i = 0; i < info->symtab_size; i++)
+    {
+      if (strcmp (bfd_asymbol_name (info->symtab[i]), RISCV_GP_SYMBOL) == 0)
+	pd->gp = bfd_asymbol_value (info->symtab[i]);
+      /* Read the address of table jump entries.  */
+      else if (strcmp (bfd_asymbol_name (info->symtab[i]),
+			      RISCV_TABLE_JUMP_BASE_SYMBOL) == 0)
+	pd->jvt_base = bfd_asymbol_value (info->symtab[i]);
     }
 
-  if (info->private_data == NULL)
+  /* find jump table section.  */
+  if (info->section && info->section->owner
+      && info->section->owner->sections)
     {
-      const bfd_vma minus = (bfd_vma) -1;
-      int i;
-      bfd_vma sym_val;
-
-      pd = info->private_data = xcalloc (1, sizeof (struct riscv_private_data));
-      pd->gp = minus;
-      pd->print_addr = minus;
-      pd->jvt_base = minus;
-      pd->jvt_end = minus;
-
-      for (i = 0; i < (int)ARRAY_SIZE (pd->hi_addr); i++)
-	pd->hi_addr[i] = minus;
-
-      for (i = 0; i < info->symtab_size; i++)
-        {
-	  if (strcmp (bfd_asymbol_name (info->symtab[i]), RISCV_GP_SYMBOL) == 0)
-	    pd->gp = bfd_asymbol_value (info->symtab[i]);
-	  /* Read the address of table jump entries.  */
-	  else if (strcmp (bfd_asymbol_name (info->symtab[i]),
-				  RISCV_TABLE_JUMP_BASE_SYMBOL) == 0)
-	    pd->jvt_base = bfd_asymbol_value (info->symtab[i]);
-	}
-
-      /* find jump table section.  */
-      if (info->section && info->section->owner
-	  && info->section->owner->sections)
+      asection *p = info->section->owner->sections;
+      const char *LD_JVT_SEC_NAME = TABLE_JUMP_SEC_NAME;
+      const char *LLD_JVT_SEC_NAME = ".riscv.jvt";
+      while (p)
 	{
-	  asection *p = info->section->owner->sections;
-	  const char *LD_JVT_SEC_NAME = TABLE_JUMP_SEC_NAME;
-	  const char *LLD_JVT_SEC_NAME = ".riscv.jvt";
-	  while (p)
+	  if (0 == strcmp (p->name, LD_JVT_SEC_NAME)
+	      || 0 == strcmp (p->name, LLD_JVT_SEC_NAME))
 	    {
-	      if (0 == strcmp (p->name, LD_JVT_SEC_NAME)
-		  || 0 == strcmp (p->name, LLD_JVT_SEC_NAME))
-		{
-		  pd->jvt_start = p->vma;
-		  pd->jvt_end = p->vma + p->size;
-		  break;
-		}
-	      p = p->next;
+	      pd->jvt_start = p->vma;
+	      pd->jvt_end = p->vma + p->size;
+	      break;
 	    }
+	  p = p->next;
 	}
+    }
 
-      /* Calculate the closest symbol from jvt base to determine the size of table jump
-          entry section.  */
-      if (pd->jvt_base != 0 && pd->jvt_end == minus)
+  /* Calculate the closest symbol from jvt base to determine the size of table jump
+      entry section.  */
+  if (pd->jvt_base != 0 && pd->jvt_end == minus)
+    {
+      for (i = 0; i < info->symtab_size; i++)
 	{
-	  for (i = 0; i < info->symtab_size; i++)
-	    {
-	      sym_val = bfd_asymbol_value (info->symtab[i]);
-	      if (sym_val > pd->jvt_base && sym_val < pd->jvt_end)
-	        pd->jvt_end = sym_val;
-	    }
+	  sym_val = bfd_asymbol_value (info->symtab[i]);
+	  if (sym_val > pd->jvt_base && sym_val < pd->jvt_end)
+	    pd->jvt_end = sym_val;
 	}
-
-      if (pd->jvt_base == minus || pd->jvt_end == minus)
-	pd->jvt_start = pd->jvt_end = 0;
-      if (pd->jvt_base != minus && pd->jvt_start < pd->jvt_base)
-	pd->jvt_start = pd->jvt_base;
     }
-  else
-    pd = info->private_data;
+
+  if (pd->jvt_base == minus || pd->jvt_end == minus)
+    pd->jvt_start = pd->jvt_end = 0;
+  if (pd->jvt_base != minus && pd->jvt_start < pd->jvt_base)
+    pd->jvt_start = pd->jvt_base;
+}
+
+/* Print the RISC-V instruction at address MEMADDR in debugged memory,
+   on using INFO.  Returns length of the instruction, in bytes.
+   BIGENDIAN must be 1 if this is big-endian code, 0 if
+   this is little-endian code.  */
+
+static int
+riscv_disassemble_insn (bfd_vma memaddr, insn_t word, disassemble_info *info)
+{
+  const struct riscv_opcode *op;
+  const struct riscv_opcode **cand;
+  struct riscv_private_data *pd;
+  int insnlen;
+
+  if (riscv_dis_tree == NULL || riscv_dis_subsets_changed)
+    riscv_dis_update_tree ();
+
+  pd = info->private_data;
 
   /* { Andes */
   if (info->section
@@ -1229,8 +1506,8 @@ riscv_disassemble_insn (bfd_vma memaddr, insn_t word, disassemble_info *info)
   info->target = 0;
   info->target2 = 0;
 
-  op = riscv_hash[OP_HASH_IDX (word)];
-  if (op != NULL)
+  cand = riscv_decode_candidates (riscv_dis_tree, word);
+  if (cand != NULL)
     {
       /* If XLEN is not known, get its value from the ELF class.  */
       if (info->mach == bfd_mach_riscv64)
@@ -1265,27 +1542,32 @@ riscv_disassemble_insn (bfd_vma memaddr, insn_t word, disassemble_info *info)
 
       /* { Andes */
       /* prefer RVC/RVP when supported.  */
-      const struct riscv_opcode *op2 = NULL;
       while (!no_prefer)
 	{
-	  /* RVC has non-canonical aliases within riscv_opcodes[].  */
-	  if (insnlen == 2 && args.has_c
-	      && andes_find_op_name_match ("c.unimp", 0, riscv_hash, &op2))
-	    break;
+	  /* RVC has non-canonical aliases within riscv_opcodes[], ahead
+	     of c.unimp.  The 16-bit candidates all come from that table,
+	     so they can be skipped by position.  */
+	  if (insnlen == 2 && riscv_dis_args.has_c
+	      && riscv_dis_rvc_start != NULL)
+	    {
+	      while (*cand != NULL && *cand < riscv_dis_rvc_start)
+		cand++;
+	      break;
+	    }
 	#if 0
 	  if (insnlen == 2 && has_c
-	      && andes_find_op_of_subset (has_rvc, 1, riscv_hash,
-					  word, &op2)) break;
+	      && andes_find_op_of_subset (has_rvc, 1, cand, word, &cand))
+	    break;
 	#endif
-	  if (insnlen == 4 && args.has_p
-	      && andes_find_op_of_subset (has_rvp, no_aliases, riscv_hash,
-					  word, &op2)) break;
+	  if (insnlen == 4 && riscv_dis_args.has_p
+	      && andes_find_op_of_subset (has_rvp, no_aliases, cand,
+					  word, &cand))
+	    break;
 	  break; /* once */
 	}
-      op = op2 ? op2 : op;
       /* } Andes */
 
-      for (; op->name; op++)
+      for (; (op = *cand) != NULL; cand++)
 	{
 	  /* Does the opcode match?  */
 	  if (! (op->match_func) (op, word))
@@ -1297,25 +1579,9 @@ riscv_disassemble_insn (bfd_vma memaddr, insn_t word, disassemble_info *info)
 	  if ((op->xlen_requirement != 0) && (op->xlen_requirement != xlen))
 	    continue;
 
-	  if (!riscv_multi_subset_supports (&riscv_rps_dis, op->insn_class))
-	    continue;
-
 	  if (!riscv_disassemble_subset_tweak (&riscv_rps_dis, op, word))
 	    continue;
 
-	  if (!is_preferred_subset (op, &args))
-	    continue;
-
-	  /* pick nexec.it if support xnexecit.  */
-	  if ((args.has_xnexecit || args.has_zcb)
-	      && ((0 == strcmp (op->name, "exec.it"))
-		  || (0 == strcmp (op->name, "ex9.it"))))
-	    continue;
-
-	  /* prefer cm.* if support zcm*.  */
-	  if (args.has_zcm && 0 == strncmp (op->name, "c.f", 3))
-	    continue;
-
 	  /* prefer c.?ext.*  */
 	  if (!no_prefer
 	      && insnlen == 2 
@@ -1429,131 +1695,100 @@ riscv_get_map_state (int n,
   return true;
 }
 
-/* Check the sorted symbol table (sorted by the symbol value), find the
-   suitable mapping symbols.  */
+static int
+riscv_map_symbol_compare (const void *a, const void *b)
+{
+  const struct riscv_map_symbol *ma = a;
+  const struct riscv_map_symbol *mb = b;
 
-static enum riscv_seg_mstate
-riscv_search_mapping_symbol (bfd_vma memaddr,
-			     struct disassemble_info *info)
+  if (ma->addr != mb->addr)
+    return ma->addr < mb->addr ? -1 : 1;
+  return ma->index - mb->index;
+}
+
+/* Collect the mapping symbols of the current section into PD, sorted by
+   address.  Symbols with the same address keep their symbol table order,
+   so that the last one wins as before.  */
+
+static void
+riscv_build_map_index (private_data_t *pd, struct disassemble_info *info)
 {
   enum riscv_seg_mstate mstate;
-  bool from_last_map_symbol;
-  bool found = false;
-  int symbol = -1;
   int n;
 
-  /* Return the last map state if the address is still within the range of the
-     last mapping symbol.  */
-  if (last_map_section == info->section
-      && (memaddr < last_map_symbol_boundary))
-    return last_map_state;
+  free (pd->map_syms);
+  pd->map_syms = NULL;
+  pd->map_count = 0;
+  pd->map_section = info->section;
+  pd->map_valid = true;
 
-  last_map_section = info->section;
+  for (n = 0; n < info->symtab_size; n++)
+    if (riscv_get_map_state (n, &mstate, info))
+      {
+	if (pd->map_syms == NULL)
+	  pd->map_syms = XNEWVEC (struct riscv_map_symbol,
+				  info->symtab_size - n);
+	pd->map_syms[pd->map_count].addr = bfd_asymbol_value (info->symtab[n]);
+	pd->map_syms[pd->map_count].index = n;
+	pd->map_syms[pd->map_count].state = mstate;
+	pd->map_count++;
+      }
 
-  /* Decide whether to print the data or instruction by default, in case
-     we can not find the corresponding mapping symbols.  */
-  mstate = MAP_DATA;
-  if ((info->section
-       && info->section->flags & SEC_CODE)
-      || !info->section)
-    mstate = MAP_INSN;
+  if (pd->map_count > 1)
+    qsort (pd->map_syms, pd->map_count, sizeof (*pd->map_syms),
+	   riscv_map_symbol_compare);
+}
+
+/* Return the number of mapping symbols of the current section at or
+   before MEMADDR, or -1 if there is no symbol table to look at.  */
+
+static int
+riscv_map_lookup (bfd_vma memaddr, struct disassemble_info *info)
+{
+  private_data_t *pd = info->private_data;
+  int lo, hi;
 
   if (info->symtab_size == 0
       || bfd_asymbol_flavour (*info->symtab) != bfd_target_elf_flavour)
-    return mstate;
-
-  /* Reset the last_map_symbol if we start to dump a new section.  */
-  if (memaddr <= 0)
-    last_map_symbol = -1;
-
-  /* If the last stop offset is different from the current one, then
-     don't use the last_map_symbol to search.  We usually reset the
-     info->stop_offset when handling a new section.  */
-  from_last_map_symbol = (last_map_symbol >= 0
-			  && info->stop_offset == last_stop_offset);
-
-  /* Start scanning at the start of the function, or wherever
-     we finished last time.  */
-  n = info->symtab_pos + 1;
-  if (from_last_map_symbol && n >= last_map_symbol)
-    n = last_map_symbol;
-
-  /* Find the suitable mapping symbol to dump.  */
-  for (; n < info->symtab_size; n++)
-    {
-      bfd_vma addr = bfd_asymbol_value (info->symtab[n]);
-      /* We have searched all possible symbols in the range.  */
-      if (addr > memaddr)
-	break;
-      if (riscv_get_map_state (n, &mstate, info))
-	{
-	  symbol = n;
-	  found = true;
-	  /* Do not stop searching, in case there are some mapping
-	     symbols have the same value, but have different names.
-	     Use the last one.  */
-	}
-    }
+    return -1;
 
-  /* We can not find the suitable mapping symbol above.  Therefore, we
-     look forwards and try to find it again, but don't go pass the start
-     of the section.  Otherwise a data section without mapping symbols
-     can pick up a text mapping symbol of a preceeding section.  */
-  if (!found)
-    {
-      n = info->symtab_pos;
-      if (from_last_map_symbol && n >= last_map_symbol)
-	n = last_map_symbol;
-
-      for (; n >= 0; n--)
-	{
-	  bfd_vma addr = bfd_asymbol_value (info->symtab[n]);
-	  /* We have searched all possible symbols in the range.  */
-	  if (addr < (info->section ? info->section->vma : 0))
-	    break;
-	  /* Stop searching once we find the closed mapping symbol.  */
-	  if (riscv_get_map_state (n, &mstate, info))
-	    {
-	      symbol = n;
-	      found = true;
-	      break;
-	    }
-	}
-    }
+  if (!pd->map_valid || pd->map_section != info->section)
+    riscv_build_map_index (pd, info);
 
-  if (found)
+  lo = 0;
+  hi = pd->map_count;
+  while (lo < hi)
     {
-      /* Find the next mapping symbol to determine the boundary of this mapping
-	 symbol.  */
+      int mid = lo + (hi - lo) / 2;
+      if (pd->map_syms[mid].addr <= memaddr)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  return lo;
+}
 
-      bool found_next = false;
-      /* Try to found next mapping symbol.  */
-      for (n = symbol + 1; n < info->symtab_size; n++)
-	{
-	  if (info->symtab[symbol]->section != info->symtab[n]->section)
-	    continue;
+/* Find the mapping state at MEMADDR.  */
 
-	  bfd_vma addr = bfd_asymbol_value (info->symtab[n]);
-	  const char *sym_name = bfd_asymbol_name(info->symtab[n]);
-	  if (sym_name[0] == '$' && (sym_name[1] == 'x' || sym_name[1] == 'd'))
-	    {
-	      /* The next mapping symbol has been found, and it represents the
-		 boundary of this mapping symbol.  */
-	      found_next = true;
-	      last_map_symbol_boundary = addr;
-	      break;
-	    }
-	}
+static enum riscv_seg_mstate
+riscv_search_mapping_symbol (bfd_vma memaddr,
+			     struct disassemble_info *info)
+{
+  private_data_t *pd = info->private_data;
+  enum riscv_seg_mstate mstate;
+  int n;
 
-      /* No further mapping symbol has been found, indicating that the boundary
-	 of the current mapping symbol is the end of this section.  */
-      if (!found_next)
-	last_map_symbol_boundary = info->section->vma + info->section->size;
-    }
+  /* Decide whether to print the data or instruction by default, in case
+     we can not find the corresponding mapping symbols.  */
+  mstate = MAP_DATA;
+  if ((info->section
+       && info->section->flags & SEC_CODE)
+      || !info->section)
+    mstate = MAP_INSN;
 
-  /* Save the information for next use.  */
-  last_map_symbol = symbol;
-  last_stop_offset = info->stop_offset;
+  n = riscv_map_lookup (memaddr, info);
+  if (n > 0)
+    mstate = pd->map_syms[n - 1].state;
 
   return mstate;
 }
@@ -1564,28 +1799,19 @@ static bfd_vma
 riscv_data_length (bfd_vma memaddr,
 		   disassemble_info *info)
 {
+  private_data_t *pd = info->private_data;
   bfd_vma length;
   bool found = false;
+  int n;
 
   length = 4;
-  if (info->symtab_size != 0
-      && bfd_asymbol_flavour (*info->symtab) == bfd_target_elf_flavour
-      && last_map_symbol >= 0)
+  n = riscv_map_lookup (memaddr, info);
+  if (n >= 0 && n < pd->map_count)
     {
-      int n;
-      enum riscv_seg_mstate m = MAP_NONE;
-      for (n = last_map_symbol + 1; n < info->symtab_size; n++)
-	{
-	  bfd_vma addr = bfd_asymbol_value (info->symtab[n]);
-	  if (addr > memaddr
-	      && riscv_get_map_state (n, &m, info))
-	    {
-	      if (addr - memaddr < length)
-		length = addr - memaddr;
-	      found = true;
-	      break;
-	    }
-	}
+      bfd_vma addr = pd->map_syms[n].addr;
+      if (addr - memaddr < length)
+	length = addr - memaddr;
+      found = true;
     }
   if (!found)
     {
@@ -1654,9 +1880,10 @@ print_insn_riscv (bfd_vma memaddr, struct disassemble_info *info)
   else if (riscv_gpr_names == NULL)
     set_default_riscv_dis_options ();
 
+  if (info->private_data == NULL)
+    riscv_init_private_data (info);
+
   mstate = riscv_search_mapping_symbol (memaddr, info);
-  /* Save the last mapping state.  */
-  last_map_state = mstate;
 
   /* Set the size to dump.  */
   if ((mstate == MAP_DATA
@@ -1725,9 +1952,21 @@ riscv_get_disassembler (bfd *abfd)
 
   riscv_release_subset_list (&riscv_subsets);
   riscv_parse_subset (&riscv_rps_dis, default_arch);
+  riscv_dis_subsets_changed = true;
   return print_insn_riscv;
 }
 
+/* Free the private data of INFO.  */
+
+void
+disassemble_free_riscv_target (struct disassemble_info *info)
+{
+  private_data_t *pd = info->private_data;
+
+  if (pd != NULL)
+    free (pd->map_syms);
+}
+
 /* Prevent use of the fake labels that are generated as part of the DWARF
    and for relaxable relocations in the assembler.  */
 
@@ -1920,140 +2159,53 @@ with the -M switch (multiple options should be separated by commas):\n"));
 }
 
 /* { Andes ACE */
-static unsigned int
-ace_get_discrete_bit_value(unsigned int bit_value, char *op_name_discrete, const char *op)
-{
-  bool found_or_token = true;
-  unsigned val, ret = 0;
-  char *psep, *pval = op_name_discrete + strlen(op);
-  unsigned msb = 0, width = 0, width_acc = 0;
-
-  while (found_or_token)
-    {
-      /* Extract msb from string */
-      psep = strchr (pval, '_');
-      *psep = '\0';
-      msb = strtoul (pval, (char **) NULL, 10);
-      /* Extract width from string */
-      pval = psep + 1;
-      psep = strchr (pval, '|');
-      if (psep)
-	*psep = '\0';
-      else
-	found_or_token = false;
-      width = strtoul (pval, (char **) NULL, 10);
-
-      /* Perform mask to truncate oversize value */
-      val = bit_value << (32 - msb - 1);
-      val >>= 32 - width;
-      val <<= width_acc;
-      ret |= val;
-      width_acc += width;
-
-      /* Prepare condition for next iteration */
-      pval = psep + 1;
-    }
-  return ret;
-}
-
 /* Print out ACE instruction assembly code */
 
 static void
 print_ace_args (const char **args, insn_t l, disassemble_info * info)
 {
   fprintf_ftype print = info->fprintf_func;
+  const ace_field_t *field = andes_ace_field (*args);
+  const ace_op_t *ace_op = field != NULL ? field->op : NULL;
+  unsigned int bit_value;
 
-  /* Extract field attribute name from opcode description (ace_ops) and
-     store the extracted result to var of op_name for finding the
-     field attribute information from ace_field_hash */
-  bool found_op_str_end = false;
-  char *pch = strchr (*args, ',');
-  if (pch == NULL)
-    {
-      pch = strchr (*args, '\0');
-      found_op_str_end = true;
-    }
-  if (pch == NULL)
-    return;
-
-  unsigned int op_name_size = pch - (*args + 1);
-  char *op_name = malloc (op_name_size + 1);
-  memcpy (op_name, *args + 1, op_name_size);
-  /* Cat null character to the end of op_name to avoid gash */
-  memcpy (op_name + op_name_size, "\0", 1);
-
-  /* With rGPR encoding format, operand bit-field may be discrete.
-     There is an "|" token in discrete format */
-  bool is_discrete = false;
-  char *por = strchr(op_name, '|');
-  char *op_name_discrete;
-  if (por != NULL)
+  if (ace_op == NULL)
     {
-      is_discrete = true;
-      op_name_discrete = malloc(op_name_size + 1);
-      strcpy(op_name_discrete, op_name);
-      *por = '\0';
-    }
-
-  /*  Find the field attribute from ace_field_hash and encode instruction */
-  ace_op_t *ace_op = NULL;
-  unsigned int i = 0;
-  while (ace_ops[i].name)
-    {
-      if (strcmp (ace_ops[i].name, op_name) == 0)
-	{
-	  ace_op = &ace_ops[i];
-	  break;
-	}
-      i++;
+      fprintf (stderr, _("ace_op is NULL\n"));
+      return;
     }
 
-  if (ace_op != NULL)
+  /* Extract the value from defined location */
+  bit_value = andes_ace_extract (field, l);
+  switch (ace_op->hw_res)
     {
-      /* Extract the value from defined location */
-      unsigned int bit_value = l;
-      bit_value <<= 32 - (ace_op->bitpos + 1);
-      bit_value >>= 32 - ace_op->bitsize;
-
-      switch (ace_op->hw_res)
-	{
-	case HW_GPR:
-	  print (info->stream, "%s", riscv_gpr_names[bit_value]);
-	  break;
+    case HW_GPR:
+      print (info->stream, "%s", riscv_gpr_names[bit_value]);
+      break;
 
-	case HW_FPR:
-	  print (info->stream, "%s", riscv_fpr_names[bit_value]);
-	  break;
+    case HW_FPR:
+      print (info->stream, "%s", riscv_fpr_names[bit_value]);
+      break;
 
-	case HW_VR:
-	  print (info->stream, "%s", riscv_vecr_names_numeric[bit_value]);
-	  break;
+    case HW_VR:
+      print (info->stream, "%s", riscv_vecr_names_numeric[bit_value]);
+      break;
 
-	case HW_UINT:
-	  if (is_discrete)
-	    bit_value = ace_get_discrete_bit_value(l, op_name_discrete, "imm");
-	  print (info->stream, "%d", bit_value);
-	  break;
+    case HW_UINT:
+      print (info->stream, "%d", bit_value);
+      break;
 
-	case HW_ACR:
-	  if (is_discrete)
-	    bit_value = ace_get_discrete_bit_value(l, op_name_discrete, ace_op->hw_name);
-	  print (info->stream, "%s_%d", ace_op->hw_name, bit_value);
-	  break;
-	}
-    }
-  else
-    {
-      fprintf (stderr, _("ace_op is NULL\n"));
-      return;
+    case HW_ACR:
+      print (info->stream, "%s_%d", ace_op->hw_name, bit_value);
+      break;
     }
 
   /* Update the address of pointer of the field attribute (*args) */
-  if (found_op_str_end == true)
-    *args = pch - 1;
+  if (*field->end == '\0')
+    *args = field->end - 1;
   else
     {
-      *args = pch;
+      *args = field->end;
       print (info->stream, ",");
     }
 }
@@ -2063,15 +2215,14 @@ print_ace_args (const char **args, insn_t l, disassemble_info * info)
 static bool
 andes_find_op_of_subset (has_subset_fun_t has_subset,
 			 int no_aliases_p,
-			 const struct riscv_opcode **hash,
+			 const struct riscv_opcode **cand,
 			 insn_t word,
-			 const struct riscv_opcode **pop)
+			 const struct riscv_opcode ***pcand)
 {
   bool is_found = false;
   const struct riscv_opcode *op;
 
-  op = hash[OP_HASH_IDX (word)];
-  for (; op->name; op++)
+  for (; (op = *cand) != NULL; cand++)
     {
       if (! has_subset (op->insn_class))
 	continue;
@@ -2082,7 +2233,7 @@ andes_find_op_of_subset (has_subset_fun_t has_subset,
       if ((op->xlen_requirement != 0) && (op->xlen_requirement != xlen))
 	continue;
       is_found = true;
-      *pop = op;
+      *pcand = cand;
       break;
     }
 
@@ -2092,14 +2243,13 @@ andes_find_op_of_subset (has_subset_fun_t has_subset,
 static bool
 andes_find_op_name_match (const char *mne,
 			  insn_t match,
-			  const riscv_opcode_t **hash,
+			  const riscv_opcode_t *table,
 			  const riscv_opcode_t **pop)
 {
   bool is_found = false;
   const riscv_opcode_t *op;
 
-  op = hash[OP_HASH_IDX (match)];
-  for (; op->name; op++)
+  for (op = table; op->name; op++)
     {
       if ((op->xlen_requirement != 0) && (op->xlen_requirement != xlen))
 	continue;
@@ -21,6 +21,7 @@
    see <http://www.gnu.org/licenses/>.  */
 
 #include "sysdep.h"
+#include "libiberty.h"
 #include "opcode/riscv.h"
 #include <stdio.h>
 
@@ -2444,3 +2445,178 @@ const struct riscv_opcode riscv_insn_types[] =
 /* Terminate the list.  */
 {0, 0, INSN_CLASS_NONE, 0, 0, 0, 0, 0}
 };
+
+/* Decode trees.  The root splits on the two low bits, giving one subtree
+   per 16-bit quadrant and one for the 32-bit and longer encodings, which
+   splits again on the major opcode.  Below that, each node splits on the
+   next field listed here that some of its candidates care about, until
+   only a handful of candidates are left.  */
+
+struct riscv_decode_level
+{
+  unsigned int shift;
+  unsigned int width;
+};
+
+/* funct3, then bits 10-12 and 5-6 (funct6 and funct2 of CA-format).  */
+static const struct riscv_decode_level riscv_decode_rvc_levels[] =
+{
+  {13, 3}, {10, 3}, {5, 2}, {0, 0}
+};
+
+/* funct3, then funct7.  */
+static const struct riscv_decode_level riscv_decode_major_levels[] =
+{
+  {12, 3}, {25, 7}, {0, 0}
+};
+
+#define RISCV_DECODE_LEAF_MAX 4
+
+/* Fill in NODE from the COUNT candidates in OPS, which are in table order
+   and all agree with the bits already dispatched on.  */
+
+static void
+riscv_decode_split (struct riscv_decode_node *node,
+		    const struct riscv_opcode **ops, size_t count,
+		    const struct riscv_decode_level *level)
+{
+  const struct riscv_opcode **sub;
+  insn_t field = 0;
+  unsigned int k;
+  size_t i, n;
+
+  for (; count > RISCV_DECODE_LEAF_MAX && level->width != 0; level++)
+    {
+      field = (((insn_t) 1 << level->width) - 1) << level->shift;
+      for (i = 0; i < count; i++)
+	if (ops[i]->mask & field)
+	  break;
+      if (i < count)
+	break;
+    }
+
+  if (count <= RISCV_DECODE_LEAF_MAX || level->width == 0)
+    {
+      node->ops = XNEWVEC (const struct riscv_opcode *, count + 1);
+      memcpy (node->ops, ops, count * sizeof (*ops));
+      node->ops[count] = NULL;
+      return;
+    }
+
+  node->shift = level->shift;
+  node->width = level->width;
+  node->children = XCNEWVEC (struct riscv_decode_node, 1u << level->width);
+  sub = XNEWVEC (const struct riscv_opcode *, count);
+  for (k = 0; k < 1u << level->width; k++)
+    {
+      insn_t bits = (insn_t) k << level->shift;
+
+      for (i = n = 0; i < count; i++)
+	if (((bits ^ ops[i]->match) & ops[i]->mask & field) == 0)
+	  sub[n++] = ops[i];
+      riscv_decode_split (&node->children[k], sub, n, level + 1);
+    }
+  free (sub);
+}
+
+/* Fill in NODE with the candidates whose low bits are IDX, under IDXMASK.
+   As in the old hash chains, they all come from the first of TABLES that
+   has an entry for IDX at all.  */
+
+static void
+riscv_decode_major (struct riscv_decode_node *node,
+		    const struct riscv_opcode *const *tables,
+		    insn_t idx, insn_t idxmask,
+		    riscv_decode_filter_t filter, void *data,
+		    const struct riscv_decode_level *levels)
+{
+  const struct riscv_opcode *table = NULL;
+  const struct riscv_opcode *op;
+  const struct riscv_opcode **ops;
+  size_t count = 0;
+
+  for (; *tables != NULL && table == NULL; tables++)
+    for (op = *tables; op->name; op++)
+      if ((op->match & (riscv_insn_length (op->match) == 2 ? 0x3 : 0x7f))
+	  == idx)
+	{
+	  table = *tables;
+	  break;
+	}
+
+  /* Leave OPS null so that callers can tell the major opcode is unused.  */
+  if (table == NULL)
+    return;
+
+  for (op = table; op->name; op++)
+    count++;
+  ops = XNEWVEC (const struct riscv_opcode *, count);
+  count = 0;
+  for (op = table; op->name; op++)
+    {
+      if (op->pinfo == INSN_MACRO || op->match_func == match_never)
+	continue;
+      if (((idx ^ op->match) & op->mask & idxmask) != 0)
+	continue;
+      if (filter != NULL && !filter (op, data))
+	continue;
+      ops[count++] = op;
+    }
+  riscv_decode_split (node, ops, count, levels);
+  free (ops);
+}
+
+/* Build a decode tree over the NULL-terminated list of opcode TABLES,
+   keeping only the entries FILTER accepts.  Macros are never kept.  */
+
+struct riscv_decode_node *
+riscv_build_decode_tree (const struct riscv_opcode *const *tables,
+			 riscv_decode_filter_t filter, void *data)
+{
+  struct riscv_decode_node *root = XCNEW (struct riscv_decode_node);
+  struct riscv_decode_node *major;
+  unsigned int k;
+
+  root->shift = 0;
+  root->width = 2;
+  root->children = XCNEWVEC (struct riscv_decode_node, 4);
+  for (k = 0; k < 3; k++)
+    riscv_decode_major (&root->children[k], tables, k, 0x3,
+			filter, data, riscv_decode_rvc_levels);
+
+  major = &root->children[3];
+  major->shift = 2;
+  major->width = 5;
+  major->children = XCNEWVEC (struct riscv_decode_node, 32);
+  for (k = 0; k < 32; k++)
+    riscv_decode_major (&major->children[k], tables, (k << 2) | 3, 0x7f,
+			filter, data, riscv_decode_major_levels);
+
+  return root;
+}
+
+static void
+riscv_free_decode_node (struct riscv_decode_node *node)
+{
+  unsigned int k;
+
+  if (node->children != NULL)
+    {
+      for (k = 0; k < 1u << node->width; k++)
+	riscv_free_decode_node (&node->children[k]);
+      free (node->children);
+    }
+  else
+    free (node->ops);
+}
+
+/* Free TREE, which came from riscv_build_decode_tree.  */
+
+void
+riscv_free_decode_tree (struct riscv_decode_node *tree)
+{
+  if (tree == NULL)
+    return;
+  riscv_free_decode_node (tree);
+  free (tree);
+}
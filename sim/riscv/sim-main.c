@@ -28,6 +28,7 @@
 #include <time.h>
 
 #include "sim-main.h"
+#include "sim-fpu.h"
 #include "sim-signal.h"
 #include "sim-syscall.h"
 
@@ -39,8 +40,8 @@
   TRACE_REGISTER (cpu, "wrote %s = %#" PRIxTW, riscv_gpr_names_abi[reg], \
 		  cpu->regs[reg])
 
-static const struct riscv_opcode *riscv_hash[OP_MASK_OP + 1];
-#define OP_HASH_IDX(i) ((i) & (riscv_insn_length (i) == 2 ? 0x3 : 0x7f))
+/* The decode tree shared with the disassembler, without aliases.  */
+static struct riscv_decode_node *riscv_decode_tree;
 
 #define RISCV_ASSERT_RV32(cpu, fmt, args...) \
   do { \
@@ -144,12 +145,14 @@ ashiftrt64 (unsigned_word val, unsigned_word shift)
 }
 
 static sim_cia
-execute_i (SIM_CPU *cpu, unsigned_word iw, const struct riscv_opcode *op)
+execute_i (SIM_CPU *cpu, const struct riscv_decoded_insn *insn)
 {
   SIM_DESC sd = CPU_STATE (cpu);
-  int rd = (iw >> OP_SH_RD) & OP_MASK_RD;
-  int rs1 = (iw >> OP_SH_RS1) & OP_MASK_RS1;
-  int rs2 = (iw >> OP_SH_RS2) & OP_MASK_RS2;
+  unsigned_word iw = insn->iw;
+  const struct riscv_opcode *op = insn->op;
+  int rd = insn->rd;
+  int rs1 = insn->rs1;
+  int rs2 = insn->rs2;
   const char *rd_name = riscv_gpr_names_abi[rd];
   const char *rs1_name = riscv_gpr_names_abi[rs1];
   const char *rs2_name = riscv_gpr_names_abi[rs2];
@@ -160,7 +163,7 @@ execute_i (SIM_CPU *cpu, unsigned_word iw, const struct riscv_opcode *op)
   unsigned_word sb_imm = EXTRACT_BTYPE_IMM (iw);
   unsigned_word shamt_imm = ((iw >> OP_SH_SHAMT) & OP_MASK_SHAMT);
   unsigned_word tmp;
-  sim_cia pc = cpu->pc + 4;
+  sim_cia pc = cpu->pc + insn->len;
 
   TRACE_EXTRACT (cpu,
 		 "rd:%-2i:%-4s  "
@@ -417,13 +420,13 @@ execute_i (SIM_CPU *cpu, unsigned_word iw, const struct riscv_opcode *op)
     case MATCH_JAL:
       TRACE_INSN (cpu, "jal %s, %" PRIiTW ";", rd_name,
 		  EXTRACT_JTYPE_IMM (iw));
-      store_rd (cpu, rd, cpu->pc + 4);
+      store_rd (cpu, rd, cpu->pc + insn->len);
       pc = cpu->pc + EXTRACT_JTYPE_IMM (iw);
       TRACE_BRANCH (cpu, "to %#" PRIxTW, pc);
       break;
     case MATCH_JALR:
       TRACE_INSN (cpu, "jalr %s, %s, %" PRIiTW ";", rd_name, rs1_name, i_imm);
-      store_rd (cpu, rd, cpu->pc + 4);
+      store_rd (cpu, rd, cpu->pc + insn->len);
       pc = cpu->regs[rs1] + i_imm;
       TRACE_BRANCH (cpu, "to %#" PRIxTW, pc);
       break;
@@ -586,7 +589,7 @@ execute_i (SIM_CPU *cpu, unsigned_word iw, const struct riscv_opcode *op)
     case MATCH_SBREAK:
       TRACE_INSN (cpu, "sbreak;");
       /* GDB expects us to step over SBREAK.  */
-      sim_engine_halt (sd, cpu, NULL, cpu->pc + 4, sim_stopped, SIM_SIGTRAP);
+      sim_engine_halt (sd, cpu, NULL, pc, sim_stopped, SIM_SIGTRAP);
       break;
     case MATCH_ECALL:
       TRACE_INSN (cpu, "ecall;");
@@ -643,17 +646,18 @@ mulhsu (int64_t a, uint64_t b)
 }
 
 static sim_cia
-execute_m (SIM_CPU *cpu, unsigned_word iw, const struct riscv_opcode *op)
+execute_m (SIM_CPU *cpu, const struct riscv_decoded_insn *insn)
 {
   SIM_DESC sd = CPU_STATE (cpu);
-  int rd = (iw >> OP_SH_RD) & OP_MASK_RD;
-  int rs1 = (iw >> OP_SH_RS1) & OP_MASK_RS1;
-  int rs2 = (iw >> OP_SH_RS2) & OP_MASK_RS2;
+  const struct riscv_opcode *op = insn->op;
+  int rd = insn->rd;
+  int rs1 = insn->rs1;
+  int rs2 = insn->rs2;
   const char *rd_name = riscv_gpr_names_abi[rd];
   const char *rs1_name = riscv_gpr_names_abi[rs1];
   const char *rs2_name = riscv_gpr_names_abi[rs2];
   unsigned_word tmp, dividend_max;
-  sim_cia pc = cpu->pc + 4;
+  sim_cia pc = cpu->pc + insn->len;
 
   dividend_max = -((unsigned_word) 1 << (WITH_TARGET_WORD_BITSIZE - 1));
 
@@ -790,19 +794,20 @@ execute_m (SIM_CPU *cpu, unsigned_word iw, const struct riscv_opcode *op)
 }
 
 static sim_cia
-execute_a (SIM_CPU *cpu, unsigned_word iw, const struct riscv_opcode *op)
+execute_a (SIM_CPU *cpu, const struct riscv_decoded_insn *insn)
 {
   SIM_DESC sd = CPU_STATE (cpu);
   struct riscv_sim_state *state = RISCV_SIM_STATE (sd);
-  int rd = (iw >> OP_SH_RD) & OP_MASK_RD;
-  int rs1 = (iw >> OP_SH_RS1) & OP_MASK_RS1;
-  int rs2 = (iw >> OP_SH_RS2) & OP_MASK_RS2;
+  const struct riscv_opcode *op = insn->op;
+  int rd = insn->rd;
+  int rs1 = insn->rs1;
+  int rs2 = insn->rs2;
   const char *rd_name = riscv_gpr_names_abi[rd];
   const char *rs1_name = riscv_gpr_names_abi[rs1];
   const char *rs2_name = riscv_gpr_names_abi[rs2];
   struct atomic_mem_reserved_list *amo_prev, *amo_curr;
   unsigned_word tmp;
-  sim_cia pc = cpu->pc + 4;
+  sim_cia pc = cpu->pc + insn->len;
 
   /* Handle these two load/store operations specifically.  */
   switch (op->match)
@@ -919,10 +924,582 @@ execute_a (SIM_CPU *cpu, unsigned_word iw, const struct riscv_opcode *op)
   return pc;
 }
 
+#define MASK_RM (OP_MASK_RM << OP_SH_RM)
+
+/* The accrued exception flags in fflags.  */
+#define FFLAGS_NX 0x01
+#define FFLAGS_UF 0x02
+#define FFLAGS_OF 0x04
+#define FFLAGS_DZ 0x08
+#define FFLAGS_NV 0x10
+
+#define CANONICAL_NAN_S 0x7fc00000
+#define CANONICAL_NAN_D 0x7ff8000000000000ull
+
+#define TRACE_FREG(cpu, reg) \
+  TRACE_REGISTER (cpu, "wrote %s = %#" PRIx64, riscv_fpr_names_abi[reg], \
+		  cpu->fpregs[reg])
+
+/* Fetch FP register REG as a single (DBL == 0) or double precision value.
+   A single precision value that is not properly NaN-boxed reads as the
+   canonical NaN.  */
+static INLINE uint64_t
+fetch_fpr (SIM_CPU *cpu, int reg, int dbl)
+{
+  uint64_t val = cpu->fpregs[reg];
+
+  if (dbl)
+    return val;
+  if ((val >> 32) != 0xffffffff)
+    return CANONICAL_NAN_S;
+  return (uint32_t) val;
+}
+
+static INLINE void
+store_fpr (SIM_CPU *cpu, int reg, uint64_t val, int dbl)
+{
+  if (!dbl)
+    val = (uint32_t) val | 0xffffffff00000000ull;
+  cpu->fpregs[reg] = val;
+  TRACE_FREG (cpu, reg);
+}
+
+static INLINE void
+fp_unpack (sim_fpu *f, uint64_t val, int dbl)
+{
+  if (dbl)
+    sim_fpu_64to (f, val);
+  else
+    sim_fpu_32to (f, val);
+}
+
+/* Round F to the destination format and pack it.  Any NaN result becomes
+   the canonical NaN.  */
+static uint64_t
+fp_pack (sim_fpu *f, int dbl, sim_fpu_round round, int *status)
+{
+  uint32_t s;
+  uint64_t d;
+
+  if (sim_fpu_is_nan (f))
+    return dbl ? CANONICAL_NAN_D : CANONICAL_NAN_S;
+
+  if (dbl)
+    {
+      *status |= sim_fpu_round_64 (f, round, sim_fpu_denorm_default);
+      sim_fpu_to64 (&d, f);
+      return d;
+    }
+
+  *status |= sim_fpu_round_32 (f, round, sim_fpu_denorm_default);
+  sim_fpu_to32 (&s, f);
+  return s;
+}
+
+/* Map the sim_fpu status bits onto fflags.  */
+static void
+accrue_fflags (SIM_CPU *cpu, int status)
+{
+  unsigned_word flags = 0;
+
+  if (status & (sim_fpu_status_invalid_snan
+		| sim_fpu_status_invalid_isi
+		| sim_fpu_status_invalid_idi
+		| sim_fpu_status_invalid_zdz
+		| sim_fpu_status_invalid_imz
+		| sim_fpu_status_invalid_cvi
+		| sim_fpu_status_invalid_cmp
+		| sim_fpu_status_invalid_sqrt
+		| sim_fpu_status_invalid_irx))
+    flags |= FFLAGS_NV;
+  if (status & sim_fpu_status_invalid_div0)
+    flags |= FFLAGS_DZ;
+  if (status & sim_fpu_status_overflow)
+    flags |= FFLAGS_OF;
+  if (status & sim_fpu_status_underflow)
+    flags |= FFLAGS_UF;
+  if (status & sim_fpu_status_inexact)
+    flags |= FFLAGS_NX;
+
+  if (flags)
+    store_csr (cpu, "fflags", CSR_FFLAGS, &cpu->csr.fflags,
+	       cpu->csr.fflags | flags);
+}
+
+/* Return the rounding mode selected by the rm field of IW.  */
+static sim_fpu_round
+fp_rounding_mode (SIM_CPU *cpu, unsigned_word iw)
+{
+  SIM_DESC sd = CPU_STATE (cpu);
+  unsigned int rm = (iw >> OP_SH_RM) & OP_MASK_RM;
+
+  /* Dynamic rounding mode.  */
+  if (rm == 7)
+    rm = cpu->csr.frm;
+
+  switch (rm)
+    {
+    case 0: /* RNE */
+      return sim_fpu_round_near;
+    case 1: /* RTZ */
+      return sim_fpu_round_zero;
+    case 2: /* RDN */
+      return sim_fpu_round_down;
+    case 3: /* RUP */
+      return sim_fpu_round_up;
+    case 4: /* RMM, which sim-fpu does not model; ties go to even.  */
+      return sim_fpu_round_near;
+    default:
+      TRACE_INSN (cpu, "invalid rounding mode %u", rm);
+      sim_engine_halt (sd, cpu, NULL, cpu->pc, sim_signalled, SIM_SIGILL);
+    }
+}
+
+static void
+fp_unary (SIM_CPU *cpu, const struct riscv_decoded_insn *insn, int dbl,
+	  int (*sim_fpu_op) (sim_fpu *, const sim_fpu *))
+{
+  sim_fpu_round round = fp_rounding_mode (cpu, insn->iw);
+  sim_fpu a, ans;
+  int status;
+
+  fp_unpack (&a, fetch_fpr (cpu, insn->rs1, dbl), dbl);
+  status = sim_fpu_op (&ans, &a);
+  store_fpr (cpu, insn->rd, fp_pack (&ans, dbl, round, &status), dbl);
+  accrue_fflags (cpu, status);
+}
+
+static void
+fp_binary (SIM_CPU *cpu, const struct riscv_decoded_insn *insn, int dbl,
+	   int (*sim_fpu_op) (sim_fpu *, const sim_fpu *, const sim_fpu *))
+{
+  sim_fpu_round round = fp_rounding_mode (cpu, insn->iw);
+  sim_fpu a, b, ans;
+  int status;
+
+  fp_unpack (&a, fetch_fpr (cpu, insn->rs1, dbl), dbl);
+  fp_unpack (&b, fetch_fpr (cpu, insn->rs2, dbl), dbl);
+  status = sim_fpu_op (&ans, &a, &b);
+  store_fpr (cpu, insn->rd, fp_pack (&ans, dbl, round, &status), dbl);
+  accrue_fflags (cpu, status);
+}
+
+/* The fmadd family.  sim-fpu has no fused operation, so the product is kept
+   at sim-fpu's internal precision and only the sum is rounded.  */
+static void
+fp_fused (SIM_CPU *cpu, const struct riscv_decoded_insn *insn, int dbl,
+	  int negate_product, int negate_addend)
+{
+  sim_fpu_round round = fp_rounding_mode (cpu, insn->iw);
+  int rs3 = (insn->iw >> OP_SH_RS3) & OP_MASK_RS3;
+  sim_fpu a, b, c, prod, ans;
+  int status;
+
+  fp_unpack (&a, fetch_fpr (cpu, insn->rs1, dbl), dbl);
+  fp_unpack (&b, fetch_fpr (cpu, insn->rs2, dbl), dbl);
+  fp_unpack (&c, fetch_fpr (cpu, rs3, dbl), dbl);
+  status = sim_fpu_mul (&prod, &a, &b);
+  if (negate_product)
+    sim_fpu_neg (&prod, &prod);
+  if (negate_addend)
+    sim_fpu_neg (&c, &c);
+  status |= sim_fpu_add (&ans, &prod, &c);
+  store_fpr (cpu, insn->rd, fp_pack (&ans, dbl, round, &status), dbl);
+  accrue_fflags (cpu, status);
+}
+
+/* fcvt from a FP register to a 32-bit or 64-bit integer register value.  */
+static void
+fp_to_int (SIM_CPU *cpu, const struct riscv_decoded_insn *insn, int dbl,
+	   int is_64bit, int is_unsigned)
+{
+  sim_fpu_round round = fp_rounding_mode (cpu, insn->iw);
+  sim_fpu a;
+  int64_t i64;
+  uint64_t u64;
+  int32_t i32;
+  uint32_t u32;
+  unsigned_word val;
+  int status;
+
+  fp_unpack (&a, fetch_fpr (cpu, insn->rs1, dbl), dbl);
+  if (sim_fpu_is_nan (&a))
+    {
+      /* NaNs convert to the largest positive value.  */
+      status = sim_fpu_status_invalid_cvi;
+      if (is_unsigned)
+	val = is_64bit ? (unsigned_word) UINT64_MAX : EXTEND32 (UINT32_MAX);
+      else
+	val = is_64bit ? (unsigned_word) INT64_MAX : INT32_MAX;
+    }
+  else if (is_unsigned && sim_fpu_sign (&a) && !sim_fpu_is_zero (&a))
+    {
+      /* sim-fpu quietly clamps negative values to zero; only those that
+	 round to zero are valid.  */
+      status = sim_fpu_to64i (&i64, &a, round);
+      if (i64 < 0 || (status & sim_fpu_status_invalid_cvi))
+	status = sim_fpu_status_invalid_cvi;
+      val = 0;
+    }
+  else if (is_64bit && is_unsigned)
+    {
+      status = sim_fpu_to64u (&u64, &a, round);
+      val = u64;
+    }
+  else if (is_64bit)
+    {
+      status = sim_fpu_to64i (&i64, &a, round);
+      val = i64;
+    }
+  else if (is_unsigned)
+    {
+      status = sim_fpu_to32u (&u32, &a, round);
+      val = EXTEND32 (u32);
+    }
+  else
+    {
+      status = sim_fpu_to32i (&i32, &a, round);
+      val = EXTEND32 (i32);
+    }
+
+  store_rd (cpu, insn->rd, val);
+  accrue_fflags (cpu, status);
+}
+
+/* fcvt from a 32-bit or 64-bit integer register value to a FP register.  */
+static void
+int_to_fp (SIM_CPU *cpu, const struct riscv_decoded_insn *insn, int dbl,
+	   int is_64bit, int is_unsigned)
+{
+  sim_fpu_round round = fp_rounding_mode (cpu, insn->iw);
+  unsigned_word val = cpu->regs[insn->rs1];
+  sim_fpu ans;
+  int status;
+
+  if (is_64bit && is_unsigned)
+    status = sim_fpu_u64to (&ans, val, round);
+  else if (is_64bit)
+    status = sim_fpu_i64to (&ans, val, round);
+  else if (is_unsigned)
+    status = sim_fpu_u32to (&ans, (uint32_t) val, round);
+  else
+    status = sim_fpu_i32to (&ans, (int32_t) val, round);
+
+  store_fpr (cpu, insn->rd, fp_pack (&ans, dbl, round, &status), dbl);
+  accrue_fflags (cpu, status);
+}
+
+/* Execute a F or D extension instruction.  DBL selects the precision of the
+   FP operands.  */
+static sim_cia
+execute_fp (SIM_CPU *cpu, const struct riscv_decoded_insn *insn, int dbl)
+{
+  SIM_DESC sd = CPU_STATE (cpu);
+  unsigned_word iw = insn->iw;
+  const struct riscv_opcode *op = insn->op;
+  int rd = insn->rd;
+  int rs1 = insn->rs1;
+  int rs2 = insn->rs2;
+  const char *rd_name = riscv_gpr_names_abi[rd];
+  const char *rs1_name = riscv_gpr_names_abi[rs1];
+  const char *frd_name = riscv_fpr_names_abi[rd];
+  const char *frs1_name = riscv_fpr_names_abi[rs1];
+  const char *frs2_name = riscv_fpr_names_abi[rs2];
+  unsigned_word i_imm = EXTRACT_ITYPE_IMM (iw);
+  unsigned_word s_imm = EXTRACT_STYPE_IMM (iw);
+  uint64_t sign = (uint64_t) 1 << (dbl ? 63 : 31);
+  uint32_t match = op->match;
+  sim_fpu_round round;
+  sim_fpu a, b;
+  uint64_t x, y;
+  unsigned_word tmp;
+  int status = 0;
+  sim_cia pc = cpu->pc + insn->len;
+
+  /* The opcode table lists most rounding instructions twice, once with the
+     rm field fixed to the dynamic mode.  Fold that back into the base
+     encoding; no instruction without a rounding mode uses funct3 7.  */
+  if ((match & MASK_RM) == MASK_RM)
+    match &= ~MASK_RM;
+
+  switch (match)
+    {
+    case MATCH_FLW:
+    case MATCH_FLD:
+      TRACE_INSN (cpu, "%s %s, %" PRIiTW "(%s);",
+		  op->name, frd_name, i_imm, rs1_name);
+      if (dbl)
+	x = sim_core_read_unaligned_8 (cpu, cpu->pc, read_map,
+				       cpu->regs[rs1] + i_imm);
+      else
+	x = sim_core_read_unaligned_4 (cpu, cpu->pc, read_map,
+				       cpu->regs[rs1] + i_imm);
+      store_fpr (cpu, rd, x, dbl);
+      break;
+    case MATCH_FSW:
+    case MATCH_FSD:
+      TRACE_INSN (cpu, "%s %s, %" PRIiTW "(%s);",
+		  op->name, frs2_name, s_imm, rs1_name);
+      if (dbl)
+	sim_core_write_unaligned_8 (cpu, cpu->pc, write_map,
+				    cpu->regs[rs1] + s_imm, cpu->fpregs[rs2]);
+      else
+	sim_core_write_unaligned_4 (cpu, cpu->pc, write_map,
+				    cpu->regs[rs1] + s_imm,
+				    (uint32_t) cpu->fpregs[rs2]);
+      break;
+
+    case MATCH_FADD_S:
+    case MATCH_FADD_D:
+      TRACE_INSN (cpu, "%s %s, %s, %s;",
+		  op->name, frd_name, frs1_name, frs2_name);
+      fp_binary (cpu, insn, dbl, sim_fpu_add);
+      break;
+    case MATCH_FSUB_S:
+    case MATCH_FSUB_D:
+      TRACE_INSN (cpu, "%s %s, %s, %s;",
+		  op->name, frd_name, frs1_name, frs2_name);
+      fp_binary (cpu, insn, dbl, sim_fpu_sub);
+      break;
+    case MATCH_FMUL_S:
+    case MATCH_FMUL_D:
+      TRACE_INSN (cpu, "%s %s, %s, %s;",
+		  op->name, frd_name, frs1_name, frs2_name);
+      fp_binary (cpu, insn, dbl, sim_fpu_mul);
+      break;
+    case MATCH_FDIV_S:
+    case MATCH_FDIV_D:
+      TRACE_INSN (cpu, "%s %s, %s, %s;",
+		  op->name, frd_name, frs1_name, frs2_name);
+      fp_binary (cpu, insn, dbl, sim_fpu_div);
+      break;
+    case MATCH_FSQRT_S:
+    case MATCH_FSQRT_D:
+      TRACE_INSN (cpu, "%s %s, %s;", op->name, frd_name, frs1_name);
+      fp_unary (cpu, insn, dbl, sim_fpu_sqrt);
+      break;
+
+    case MATCH_FMADD_S:
+    case MATCH_FMADD_D:
+      TRACE_INSN (cpu, "%s %s, %s, %s, %s;", op->name, frd_name, frs1_name,
+		  frs2_name, riscv_fpr_names_abi[(iw >> OP_SH_RS3) & OP_MASK_RS3]);
+      fp_fused (cpu, insn, dbl, 0, 0);
+      break;
+    case MATCH_FMSUB_S:
+    case MATCH_FMSUB_D:
+      TRACE_INSN (cpu, "%s %s, %s, %s, %s;", op->name, frd_name, frs1_name,
+		  frs2_name, riscv_fpr_names_abi[(iw >> OP_SH_RS3) & OP_MASK_RS3]);
+      fp_fused (cpu, insn, dbl, 0, 1);
+      break;
+    case MATCH_FNMSUB_S:
+    case MATCH_FNMSUB_D:
+      TRACE_INSN (cpu, "%s %s, %s, %s, %s;", op->name, frd_name, frs1_name,
+		  frs2_name, riscv_fpr_names_abi[(iw >> OP_SH_RS3) & OP_MASK_RS3]);
+      fp_fused (cpu, insn, dbl, 1, 0);
+      break;
+    case MATCH_FNMADD_S:
+    case MATCH_FNMADD_D:
+      TRACE_INSN (cpu, "%s %s, %s, %s, %s;", op->name, frd_name, frs1_name,
+		  frs2_name, riscv_fpr_names_abi[(iw >> OP_SH_RS3) & OP_MASK_RS3]);
+      fp_fused (cpu, insn, dbl, 1, 1);
+      break;
+
+    case MATCH_FSGNJ_S:
+    case MATCH_FSGNJ_D:
+    case MATCH_FSGNJN_S:
+    case MATCH_FSGNJN_D:
+    case MATCH_FSGNJX_S:
+    case MATCH_FSGNJX_D:
+      TRACE_INSN (cpu, "%s %s, %s, %s;",
+		  op->name, frd_name, frs1_name, frs2_name);
+      x = fetch_fpr (cpu, rs1, dbl);
+      y = fetch_fpr (cpu, rs2, dbl);
+      if (match == MATCH_FSGNJN_S || match == MATCH_FSGNJN_D)
+	y = ~y;
+      else if (match == MATCH_FSGNJX_S || match == MATCH_FSGNJX_D)
+	y ^= x;
+      store_fpr (cpu, rd, (x & ~sign) | (y & sign), dbl);
+      break;
+
+    case MATCH_FMIN_S:
+    case MATCH_FMIN_D:
+    case MATCH_FMAX_S:
+    case MATCH_FMAX_D:
+      TRACE_INSN (cpu, "%s %s, %s, %s;",
+		  op->name, frd_name, frs1_name, frs2_name);
+      x = fetch_fpr (cpu, rs1, dbl);
+      y = fetch_fpr (cpu, rs2, dbl);
+      fp_unpack (&a, x, dbl);
+      fp_unpack (&b, y, dbl);
+      if (sim_fpu_is_snan (&a) || sim_fpu_is_snan (&b))
+	status = sim_fpu_status_invalid_snan;
+      /* A NaN operand yields the other operand.  */
+      if (sim_fpu_is_nan (&a) && sim_fpu_is_nan (&b))
+	x = dbl ? CANONICAL_NAN_D : CANONICAL_NAN_S;
+      else if (sim_fpu_is_nan (&a))
+	x = y;
+      else if (!sim_fpu_is_nan (&b))
+	{
+	  int is_max = (match == MATCH_FMAX_S || match == MATCH_FMAX_D);
+	  int pick_b;
+
+	  /* -0.0 orders below +0.0 here.  */
+	  if (sim_fpu_is_zero (&a) && sim_fpu_is_zero (&b))
+	    pick_b = is_max ? sim_fpu_sign (&a) : sim_fpu_sign (&b);
+	  else if (is_max)
+	    pick_b = sim_fpu_is_gt (&b, &a);
+	  else
+	    pick_b = sim_fpu_is_lt (&b, &a);
+	  if (pick_b)
+	    x = y;
+	}
+      store_fpr (cpu, rd, x, dbl);
+      accrue_fflags (cpu, status);
+      break;
+
+    case MATCH_FEQ_S:
+    case MATCH_FEQ_D:
+    case MATCH_FLT_S:
+    case MATCH_FLT_D:
+    case MATCH_FLE_S:
+    case MATCH_FLE_D:
+      TRACE_INSN (cpu, "%s %s, %s, %s;",
+		  op->name, rd_name, frs1_name, frs2_name);
+      fp_unpack (&a, fetch_fpr (cpu, rs1, dbl), dbl);
+      fp_unpack (&b, fetch_fpr (cpu, rs2, dbl), dbl);
+      if (sim_fpu_is_nan (&a) || sim_fpu_is_nan (&b))
+	{
+	  /* feq is a quiet comparison, flt and fle are signaling.  */
+	  if ((match != MATCH_FEQ_S && match != MATCH_FEQ_D)
+	      || sim_fpu_is_snan (&a) || sim_fpu_is_snan (&b))
+	    status = sim_fpu_status_invalid_cmp;
+	  tmp = 0;
+	}
+      else if (match == MATCH_FEQ_S || match == MATCH_FEQ_D)
+	tmp = sim_fpu_is_eq (&a, &b);
+      else if (match == MATCH_FLT_S || match == MATCH_FLT_D)
+	tmp = sim_fpu_is_lt (&a, &b);
+      else
+	tmp = sim_fpu_is_le (&a, &b);
+      store_rd (cpu, rd, tmp);
+      accrue_fflags (cpu, status);
+      break;
+
+    case MATCH_FCLASS_S:
+    case MATCH_FCLASS_D:
+      TRACE_INSN (cpu, "%s %s, %s;", op->name, rd_name, frs1_name);
+      fp_unpack (&a, fetch_fpr (cpu, rs1, dbl), dbl);
+      switch (sim_fpu_is (&a))
+	{
+	case SIM_FPU_IS_NINF: tmp = 1 << 0; break;
+	case SIM_FPU_IS_NNUMBER: tmp = 1 << 1; break;
+	case SIM_FPU_IS_NDENORM: tmp = 1 << 2; break;
+	case SIM_FPU_IS_NZERO: tmp = 1 << 3; break;
+	case SIM_FPU_IS_PZERO: tmp = 1 << 4; break;
+	case SIM_FPU_IS_PDENORM: tmp = 1 << 5; break;
+	case SIM_FPU_IS_PNUMBER: tmp = 1 << 6; break;
+	case SIM_FPU_IS_PINF: tmp = 1 << 7; break;
+	case SIM_FPU_IS_SNAN: tmp = 1 << 8; break;
+	default: tmp = 1 << 9; break;
+	}
+      store_rd (cpu, rd, tmp);
+      break;
+
+    case MATCH_FMV_X_S:
+      TRACE_INSN (cpu, "fmv.x.w %s, %s;", rd_name, frs1_name);
+      store_rd (cpu, rd, EXTEND32 (cpu->fpregs[rs1]));
+      break;
+    case MATCH_FMV_S_X:
+      TRACE_INSN (cpu, "fmv.w.x %s, %s;", frd_name, rs1_name);
+      store_fpr (cpu, rd, cpu->regs[rs1], 0);
+      break;
+    case MATCH_FMV_X_D:
+      TRACE_INSN (cpu, "fmv.x.d %s, %s;", rd_name, frs1_name);
+      RISCV_ASSERT_RV64 (cpu, "insn: %s", op->name);
+      store_rd (cpu, rd, cpu->fpregs[rs1]);
+      break;
+    case MATCH_FMV_D_X:
+      TRACE_INSN (cpu, "fmv.d.x %s, %s;", frd_name, rs1_name);
+      RISCV_ASSERT_RV64 (cpu, "insn: %s", op->name);
+      store_fpr (cpu, rd, cpu->regs[rs1], 1);
+      break;
+
+    case MATCH_FCVT_S_D:
+      TRACE_INSN (cpu, "fcvt.s.d %s, %s;", frd_name, frs1_name);
+      round = fp_rounding_mode (cpu, iw);
+      fp_unpack (&a, fetch_fpr (cpu, rs1, 1), 1);
+      if (sim_fpu_is_snan (&a))
+	status = sim_fpu_status_invalid_snan;
+      store_fpr (cpu, rd, fp_pack (&a, 0, round, &status), 0);
+      accrue_fflags (cpu, status);
+      break;
+    case MATCH_FCVT_D_S:
+      TRACE_INSN (cpu, "fcvt.d.s %s, %s;", frd_name, frs1_name);
+      fp_unpack (&a, fetch_fpr (cpu, rs1, 0), 0);
+      if (sim_fpu_is_snan (&a))
+	status = sim_fpu_status_invalid_snan;
+      store_fpr (cpu, rd, fp_pack (&a, 1, sim_fpu_round_near, &status), 1);
+      accrue_fflags (cpu, status);
+      break;
+
+    case MATCH_FCVT_W_S:
+    case MATCH_FCVT_W_D:
+      TRACE_INSN (cpu, "%s %s, %s;", op->name, rd_name, frs1_name);
+      fp_to_int (cpu, insn, dbl, 0, 0);
+      break;
+    case MATCH_FCVT_WU_S:
+    case MATCH_FCVT_WU_D:
+      TRACE_INSN (cpu, "%s %s, %s;", op->name, rd_name, frs1_name);
+      fp_to_int (cpu, insn, dbl, 0, 1);
+      break;
+    case MATCH_FCVT_L_S:
+    case MATCH_FCVT_L_D:
+      TRACE_INSN (cpu, "%s %s, %s;", op->name, rd_name, frs1_name);
+      RISCV_ASSERT_RV64 (cpu, "insn: %s", op->name);
+      fp_to_int (cpu, insn, dbl, 1, 0);
+      break;
+    case MATCH_FCVT_LU_S:
+    case MATCH_FCVT_LU_D:
+      TRACE_INSN (cpu, "%s %s, %s;", op->name, rd_name, frs1_name);
+      RISCV_ASSERT_RV64 (cpu, "insn: %s", op->name);
+      fp_to_int (cpu, insn, dbl, 1, 1);
+      break;
+    case MATCH_FCVT_S_W:
+    case MATCH_FCVT_D_W:
+      TRACE_INSN (cpu, "%s %s, %s;", op->name, frd_name, rs1_name);
+      int_to_fp (cpu, insn, dbl, 0, 0);
+      break;
+    case MATCH_FCVT_S_WU:
+    case MATCH_FCVT_D_WU:
+      TRACE_INSN (cpu, "%s %s, %s;", op->name, frd_name, rs1_name);
+      int_to_fp (cpu, insn, dbl, 0, 1);
+      break;
+    case MATCH_FCVT_S_L:
+    case MATCH_FCVT_D_L:
+      TRACE_INSN (cpu, "%s %s, %s;", op->name, frd_name, rs1_name);
+      RISCV_ASSERT_RV64 (cpu, "insn: %s", op->name);
+      int_to_fp (cpu, insn, dbl, 1, 0);
+      break;
+    case MATCH_FCVT_S_LU:
+    case MATCH_FCVT_D_LU:
+      TRACE_INSN (cpu, "%s %s, %s;", op->name, frd_name, rs1_name);
+      RISCV_ASSERT_RV64 (cpu, "insn: %s", op->name);
+      int_to_fp (cpu, insn, dbl, 1, 1);
+      break;
+
+    default:
+      TRACE_INSN (cpu, "UNHANDLED INSN: %s", op->name);
+      sim_engine_halt (sd, cpu, NULL, cpu->pc, sim_signalled, SIM_SIGILL);
+    }
+
+  return pc;
+}
+
 static sim_cia
-execute_one (SIM_CPU *cpu, unsigned_word iw, const struct riscv_opcode *op)
+execute_one (SIM_CPU *cpu, const struct riscv_decoded_insn *insn)
 {
   SIM_DESC sd = CPU_STATE (cpu);
+  const struct riscv_opcode *op = insn->op;
 
   if (op->xlen_requirement == 32)
     RISCV_ASSERT_RV32 (cpu, "insn: %s", op->name);
@@ -932,17 +1509,296 @@ execute_one (SIM_CPU *cpu, unsigned_word iw, const struct riscv_opcode *op)
   switch (op->insn_class)
     {
     case INSN_CLASS_A:
-      return execute_a (cpu, iw, op);
+      return execute_a (cpu, insn);
     case INSN_CLASS_I:
-      return execute_i (cpu, iw, op);
+    case INSN_CLASS_ZICSR:
+    case INSN_CLASS_ZIFENCEI:
+      return execute_i (cpu, insn);
     case INSN_CLASS_M:
-      return execute_m (cpu, iw, op);
+      return execute_m (cpu, insn);
+    case INSN_CLASS_F:
+    case INSN_CLASS_F_OR_ZFINX:
+      if (cpu->csr.misa & (1 << ('F' - 'A')))
+	return execute_fp (cpu, insn, 0);
+      break;
+    case INSN_CLASS_D:
+    case INSN_CLASS_D_OR_ZDINX:
+      if (cpu->csr.misa & (1 << ('D' - 'A')))
+	return execute_fp (cpu, insn, 1);
+      break;
     default:
-      TRACE_INSN (cpu, "UNHANDLED EXTENSION: %d", op->insn_class);
+      break;
+    }
+
+  TRACE_INSN (cpu, "UNHANDLED EXTENSION: %d", op->insn_class);
+  sim_engine_halt (sd, cpu, NULL, cpu->pc, sim_signalled, SIM_SIGILL);
+}
+
+/* Keep only the canonical instructions in the decode tree.  */
+static int
+riscv_decode_keep_op (const struct riscv_opcode *op,
+		      void *data ATTRIBUTE_UNUSED)
+{
+  return !(op->pinfo & INSN_ALIAS);
+}
+
+/* Find the opcode table entry for IW.  */
+static const struct riscv_opcode *
+riscv_lookup_opcode (unsigned_word iw, int xlen)
+{
+  const struct riscv_opcode **cand
+    = riscv_decode_candidates (riscv_decode_tree, iw);
+  const struct riscv_opcode *op;
+
+  if (!cand)
+    return NULL;
+
+  /* NB: Same loop logic as riscv_disassemble_insn.  */
+  for (; (op = *cand) != NULL; cand++)
+    {
+      /* Does the opcode match?  */
+      if (! op->match_func (op, iw))
+	continue;
+      /* Is this instruction restricted to a certain value of XLEN?  */
+      if (op->xlen_requirement != 0 && op->xlen_requirement != xlen)
+	continue;
+
+      /* It's a match.  */
+      return op;
+    }
+
+  return NULL;
+}
+
+#define RVC_RD(iw) (((iw) >> OP_SH_RD) & OP_MASK_RD)
+#define RVC_RS2(iw) (((iw) >> OP_SH_CRS2) & OP_MASK_CRS2)
+#define RVC_RS1S(iw) (8 + (((iw) >> OP_SH_CRS1S) & OP_MASK_CRS1S))
+#define RVC_RS2S(iw) (8 + (((iw) >> OP_SH_CRS2S) & OP_MASK_CRS2S))
+
+#define RV_RTYPE(match, rd, rs1, rs2) \
+  ((match) | ((rd) << OP_SH_RD) | ((rs1) << OP_SH_RS1) | ((rs2) << OP_SH_RS2))
+#define RV_ITYPE(match, rd, rs1, imm) \
+  ((match) | ((rd) << OP_SH_RD) | ((rs1) << OP_SH_RS1) \
+   | ENCODE_ITYPE_IMM (imm))
+#define RV_STYPE(match, rs1, rs2, imm) \
+  ((match) | ((rs1) << OP_SH_RS1) | ((rs2) << OP_SH_RS2) \
+   | ENCODE_STYPE_IMM (imm))
+#define RV_BTYPE(match, rs1, rs2, imm) \
+  ((match) | ((rs1) << OP_SH_RS1) | ((rs2) << OP_SH_RS2) \
+   | ENCODE_BTYPE_IMM (imm))
+#define RV_SHIFT(match, rd, rs1, shamt) \
+  ((match) | ((rd) << OP_SH_RD) | ((rs1) << OP_SH_RS1) \
+   | ((shamt) << OP_SH_SHAMT))
+
+/* Expand the compressed instruction IW, whose opcode entry is OP, into the
+   equivalent 32-bit instruction.  Return 0 if there is none.  Several RVC
+   encodings are shared between RV32 and RV64 instructions, or are told apart
+   by a zero register field, so some cases below cover more than one entry
+   of the opcode table.  */
+static unsigned_word
+riscv_expand_rvc (unsigned_word iw, const struct riscv_opcode *op)
+{
+  unsigned_word shamt = EXTRACT_CITYPE_IMM (iw) & 0x3f;
+
+  switch (op->match)
+    {
+    case MATCH_C_ADDI4SPN: /* Also c.unimp.  */
+      if (EXTRACT_CIWTYPE_ADDI4SPN_IMM (iw) == 0)
+	return 0;
+      return RV_ITYPE (MATCH_ADDI, RVC_RS2S (iw), X_SP,
+		       EXTRACT_CIWTYPE_ADDI4SPN_IMM (iw));
+    case MATCH_C_LW:
+      return RV_ITYPE (MATCH_LW, RVC_RS2S (iw), RVC_RS1S (iw),
+		       EXTRACT_CLTYPE_LW_IMM (iw));
+    case MATCH_C_LD: /* Also c.flw.  */
+      if (op->xlen_requirement == 32)
+	return RV_ITYPE (MATCH_FLW, RVC_RS2S (iw), RVC_RS1S (iw),
+			 EXTRACT_CLTYPE_LW_IMM (iw));
+      return RV_ITYPE (MATCH_LD, RVC_RS2S (iw), RVC_RS1S (iw),
+		       EXTRACT_CLTYPE_LD_IMM (iw));
+    case MATCH_C_FLD:
+      return RV_ITYPE (MATCH_FLD, RVC_RS2S (iw), RVC_RS1S (iw),
+		       EXTRACT_CLTYPE_LD_IMM (iw));
+    case MATCH_C_SW:
+      return RV_STYPE (MATCH_SW, RVC_RS1S (iw), RVC_RS2S (iw),
+		       EXTRACT_CLTYPE_LW_IMM (iw));
+    case MATCH_C_SD: /* Also c.fsw.  */
+      if (op->xlen_requirement == 32)
+	return RV_STYPE (MATCH_FSW, RVC_RS1S (iw), RVC_RS2S (iw),
+			 EXTRACT_CLTYPE_LW_IMM (iw));
+      return RV_STYPE (MATCH_SD, RVC_RS1S (iw), RVC_RS2S (iw),
+		       EXTRACT_CLTYPE_LD_IMM (iw));
+    case MATCH_C_FSD:
+      return RV_STYPE (MATCH_FSD, RVC_RS1S (iw), RVC_RS2S (iw),
+		       EXTRACT_CLTYPE_LD_IMM (iw));
+
+    case MATCH_C_ADDI:
+      return RV_ITYPE (MATCH_ADDI, RVC_RD (iw), RVC_RD (iw),
+		       EXTRACT_CITYPE_IMM (iw));
+    case MATCH_C_ADDIW: /* Also c.jal.  */
+      if (op->xlen_requirement == 32)
+	return MATCH_JAL | (X_RA << OP_SH_RD)
+	       | ENCODE_JTYPE_IMM (EXTRACT_CJTYPE_IMM (iw));
+      return RV_ITYPE (MATCH_ADDIW, RVC_RD (iw), RVC_RD (iw),
+		       EXTRACT_CITYPE_IMM (iw));
+    case MATCH_C_LI:
+      return RV_ITYPE (MATCH_ADDI, RVC_RD (iw), 0, EXTRACT_CITYPE_IMM (iw));
+    case MATCH_C_ADDI16SP:
+      return RV_ITYPE (MATCH_ADDI, X_SP, X_SP,
+		       EXTRACT_CITYPE_ADDI16SP_IMM (iw));
+    case MATCH_C_LUI:
+      return MATCH_LUI | (RVC_RD (iw) << OP_SH_RD)
+	     | ENCODE_UTYPE_IMM (EXTRACT_CITYPE_LUI_IMM (iw));
+    case MATCH_C_SRLI: /* Also c.srli64.  */
+      return RV_SHIFT (MATCH_SRLI, RVC_RS1S (iw), RVC_RS1S (iw), shamt);
+    case MATCH_C_SRAI: /* Also c.srai64.  */
+      return RV_SHIFT (MATCH_SRAI, RVC_RS1S (iw), RVC_RS1S (iw), shamt);
+    case MATCH_C_ANDI:
+      return RV_ITYPE (MATCH_ANDI, RVC_RS1S (iw), RVC_RS1S (iw),
+		       EXTRACT_CITYPE_IMM (iw));
+    case MATCH_C_SUB:
+      return RV_RTYPE (MATCH_SUB, RVC_RS1S (iw), RVC_RS1S (iw), RVC_RS2S (iw));
+    case MATCH_C_XOR:
+      return RV_RTYPE (MATCH_XOR, RVC_RS1S (iw), RVC_RS1S (iw), RVC_RS2S (iw));
+    case MATCH_C_OR:
+      return RV_RTYPE (MATCH_OR, RVC_RS1S (iw), RVC_RS1S (iw), RVC_RS2S (iw));
+    case MATCH_C_AND:
+      return RV_RTYPE (MATCH_AND, RVC_RS1S (iw), RVC_RS1S (iw), RVC_RS2S (iw));
+    case MATCH_C_SUBW:
+      return RV_RTYPE (MATCH_SUBW, RVC_RS1S (iw), RVC_RS1S (iw),
+		       RVC_RS2S (iw));
+    case MATCH_C_ADDW:
+      return RV_RTYPE (MATCH_ADDW, RVC_RS1S (iw), RVC_RS1S (iw),
+		       RVC_RS2S (iw));
+    case MATCH_C_J:
+      return MATCH_JAL | ENCODE_JTYPE_IMM (EXTRACT_CJTYPE_IMM (iw));
+    case MATCH_C_BEQZ:
+      return RV_BTYPE (MATCH_BEQ, RVC_RS1S (iw), 0, EXTRACT_CBTYPE_IMM (iw));
+    case MATCH_C_BNEZ:
+      return RV_BTYPE (MATCH_BNE, RVC_RS1S (iw), 0, EXTRACT_CBTYPE_IMM (iw));
+
+    case MATCH_C_SLLI: /* Also c.slli64.  */
+      return RV_SHIFT (MATCH_SLLI, RVC_RD (iw), RVC_RD (iw), shamt);
+    case MATCH_C_LWSP:
+      return RV_ITYPE (MATCH_LW, RVC_RD (iw), X_SP,
+		       EXTRACT_CITYPE_LWSP_IMM (iw));
+    case MATCH_C_LDSP: /* Also c.flwsp.  */
+      if (op->xlen_requirement == 32)
+	return RV_ITYPE (MATCH_FLW, RVC_RD (iw), X_SP,
+			 EXTRACT_CITYPE_LWSP_IMM (iw));
+      return RV_ITYPE (MATCH_LD, RVC_RD (iw), X_SP,
+		       EXTRACT_CITYPE_LDSP_IMM (iw));
+    case MATCH_C_FLDSP:
+      return RV_ITYPE (MATCH_FLD, RVC_RD (iw), X_SP,
+		       EXTRACT_CITYPE_LDSP_IMM (iw));
+    case MATCH_C_MV: /* Also c.jr.  */
+      if (RVC_RS2 (iw) == 0)
+	return RV_ITYPE (MATCH_JALR, 0, RVC_RD (iw), 0);
+      return RV_RTYPE (MATCH_ADD, RVC_RD (iw), 0, RVC_RS2 (iw));
+    case MATCH_C_ADD: /* Also c.ebreak and c.jalr.  */
+      if (RVC_RS2 (iw) == 0 && RVC_RD (iw) == 0)
+	return MATCH_EBREAK;
+      if (RVC_RS2 (iw) == 0)
+	return RV_ITYPE (MATCH_JALR, X_RA, RVC_RD (iw), 0);
+      return RV_RTYPE (MATCH_ADD, RVC_RD (iw), RVC_RD (iw), RVC_RS2 (iw));
+    case MATCH_C_SWSP:
+      return RV_STYPE (MATCH_SW, X_SP, RVC_RS2 (iw),
+		       EXTRACT_CSSTYPE_SWSP_IMM (iw));
+    case MATCH_C_SDSP: /* Also c.fswsp.  */
+      if (op->xlen_requirement == 32)
+	return RV_STYPE (MATCH_FSW, X_SP, RVC_RS2 (iw),
+			 EXTRACT_CSSTYPE_SWSP_IMM (iw));
+      return RV_STYPE (MATCH_SD, X_SP, RVC_RS2 (iw),
+		       EXTRACT_CSSTYPE_SDSP_IMM (iw));
+    case MATCH_C_FSDSP:
+      return RV_STYPE (MATCH_FSD, X_SP, RVC_RS2 (iw),
+		       EXTRACT_CSSTYPE_SDSP_IMM (iw));
+    }
+
+  return 0;
+}
+
+/* Decode the LEN byte instruction IW into INSN, halting if it is not a
+   valid instruction for this cpu.  */
+static void
+riscv_decode_insn (SIM_CPU *cpu, unsigned_word iw, unsigned int len,
+		   struct riscv_decoded_insn *insn)
+{
+  SIM_DESC sd = CPU_STATE (cpu);
+  int xlen = RISCV_XLEN (cpu);
+  const struct riscv_opcode *op;
+  unsigned_word expanded = iw;
+
+  insn->op = NULL;
+
+  op = riscv_lookup_opcode (iw, xlen);
+  if (op && len == 2)
+    {
+      if (!(cpu->csr.misa & (1 << ('C' - 'A'))))
+	op = NULL;
+      else if ((expanded = riscv_expand_rvc (iw, op)) == 0)
+	op = NULL;
+      else
+	op = riscv_lookup_opcode ((uint32_t) expanded, xlen);
+    }
+  if (!op)
+    {
+      TRACE_INSN (cpu, "UNHANDLED INSN: %#" PRIxTW, iw);
       sim_engine_halt (sd, cpu, NULL, cpu->pc, sim_signalled, SIM_SIGILL);
     }
 
-  return cpu->pc + riscv_insn_length (iw);
+  insn->raw = iw;
+  insn->iw = (uint32_t) expanded;
+  insn->len = len;
+  insn->rd = (insn->iw >> OP_SH_RD) & OP_MASK_RD;
+  insn->rs1 = (insn->iw >> OP_SH_RS1) & OP_MASK_RS1;
+  insn->rs2 = (insn->iw >> OP_SH_RS2) & OP_MASK_RS2;
+  insn->op = op;
+}
+
+/* Return the decode cache slot for PC, allocating its page on demand.  */
+static struct riscv_decoded_insn *
+riscv_insn_cache_slot (SIM_CPU *cpu, address_word pc)
+{
+  address_word tag = pc >> RISCV_INSN_CACHE_PAGE_SHIFT;
+  struct riscv_insn_cache_page **pagep
+    = &cpu->insn_cache[tag % RISCV_INSN_CACHE_PAGES];
+  struct riscv_insn_cache_page *page = *pagep;
+
+  if (page == NULL)
+    {
+      page = *pagep = ZALLOC (struct riscv_insn_cache_page);
+      page->tag = tag;
+    }
+  else if (page->tag != tag)
+    {
+      memset (page->insns, 0, sizeof (page->insns));
+      page->tag = tag;
+    }
+
+  return &page->insns[(pc >> 1) & (RISCV_INSN_CACHE_PAGE_SLOTS - 1)];
+}
+
+/* Drop every cached decode for CPU.  */
+static void
+riscv_flush_insn_cache (SIM_CPU *cpu)
+{
+  int i;
+
+  for (i = 0; i < RISCV_INSN_CACHE_PAGES; ++i)
+    {
+      free (cpu->insn_cache[i]);
+      cpu->insn_cache[i] = NULL;
+    }
+}
+
+void
+riscv_sim_close (SIM_DESC sd, int quitting)
+{
+  int i;
+
+  for (i = 0; i < MAX_NR_PROCESSORS; ++i)
+    riscv_flush_insn_cache (STATE_CPU (sd, i));
 }
 
 /* Decode & execute a single instruction.  */
@@ -952,8 +1808,7 @@ void step_once (SIM_CPU *cpu)
   unsigned_word iw;
   unsigned int len;
   sim_cia pc = cpu->pc;
-  const struct riscv_opcode *op;
-  int xlen = RISCV_XLEN (cpu);
+  struct riscv_decoded_insn *insn;
 
   if (TRACE_ANY_P (cpu))
     trace_prefix (sd, cpu, NULL_CIA, pc, TRACE_LINENUM_P (cpu),
@@ -961,41 +1816,28 @@ void step_once (SIM_CPU *cpu)
 
   iw = sim_core_read_aligned_2 (cpu, pc, exec_map, pc);
 
-  /* Reject non-32-bit opcodes first.  */
+  /* Reject longer than 32-bit opcodes first.  */
   len = riscv_insn_length (iw);
-  if (len != 4)
+  if (len != 2 && len != 4)
     {
       sim_io_printf (sd, "sim: bad insn len %#x @ %#" PRIxTA ": %#" PRIxTW "\n",
 		     len, pc, iw);
       sim_engine_halt (sd, cpu, NULL, pc, sim_signalled, SIM_SIGILL);
     }
 
-  iw |= ((unsigned_word) sim_core_read_aligned_2 (
-    cpu, pc, exec_map, pc + 2) << 16);
-
-  TRACE_CORE (cpu, "0x%08" PRIxTW, iw);
+  if (len == 4)
+    iw |= ((unsigned_word) sim_core_read_aligned_2 (
+      cpu, pc, exec_map, pc + 2) << 16);
 
-  op = riscv_hash[OP_HASH_IDX (iw)];
-  if (!op)
-    sim_engine_halt (sd, cpu, NULL, pc, sim_signalled, SIM_SIGILL);
+  TRACE_CORE (cpu, "0x%0*" PRIxTW, len * 2, iw);
 
-  /* NB: Same loop logic as riscv_disassemble_insn.  */
-  for (; op->name; op++)
-    {
-      /* Does the opcode match?  */
-      if (! op->match_func (op, iw))
-	continue;
-      /* Is this a pseudo-instruction and may we print it as such?  */
-      if (op->pinfo & INSN_ALIAS)
-	continue;
-      /* Is this instruction restricted to a certain value of XLEN?  */
-      if (op->xlen_requirement != 0 && op->xlen_requirement != xlen)
-	continue;
+  /* The fetch above is still needed to validate the cached decode, but it
+     saves the opcode table walk and, for RVC, the expansion.  */
+  insn = riscv_insn_cache_slot (cpu, pc);
+  if (insn->op == NULL || insn->raw != iw)
+    riscv_decode_insn (cpu, iw, len, insn);
 
-      /* It's a match.  */
-      pc = execute_one (cpu, iw, op);
-      break;
-    }
+  pc = execute_one (cpu, insn);
 
   /* TODO: Handle overflow into high 32 bits.  */
   /* TODO: Try to use a common counter and only update on demand (reads).  */
@@ -1004,7 +1846,7 @@ void step_once (SIM_CPU *cpu)
 
   cpu->pc = pc;
 }
-
+
 /* Return the program counter for this cpu. */
 static sim_cia
 pc_get (sim_cpu *cpu)
@@ -1023,7 +1865,12 @@ static int
 reg_fetch (sim_cpu *cpu, int rn, unsigned char *buf, int len)
 {
   if (len <= 0 || len > sizeof (unsigned_word))
-    return -1;
+    {
+      /* The FP registers are always 64 bits wide.  */
+      if (len != sizeof (uint64_t)
+	  || rn < SIM_RISCV_FIRST_FP_REGNUM || rn > SIM_RISCV_LAST_FP_REGNUM)
+	return -1;
+    }
 
   switch (rn)
     {
@@ -1056,7 +1903,12 @@ static int
 reg_store (sim_cpu *cpu, int rn, unsigned char *buf, int len)
 {
   if (len <= 0 || len > sizeof (unsigned_word))
-    return -1;
+    {
+      /* The FP registers are always 64 bits wide.  */
+      if (len != sizeof (uint64_t)
+	  || rn < SIM_RISCV_FIRST_FP_REGNUM || rn > SIM_RISCV_LAST_FP_REGNUM)
+	return -1;
+    }
 
   switch (rn)
     {
@@ -1101,13 +1953,13 @@ initialize_cpu (SIM_DESC sd, SIM_CPU *cpu, int mhartid)
   CPU_REG_FETCH (cpu) = reg_fetch;
   CPU_REG_STORE (cpu) = reg_store;
 
-  if (!riscv_hash[0])
+  if (!riscv_decode_tree)
     {
-      const struct riscv_opcode *op;
+      static const struct riscv_opcode *const tables[] =
+	{ riscv_opcodes, NULL };
 
-      for (op = riscv_opcodes; op->name; op++)
-	if (!riscv_hash[OP_HASH_IDX (op->match)])
-	  riscv_hash[OP_HASH_IDX (op->match)] = op;
+      riscv_decode_tree
+	= riscv_build_decode_tree (tables, riscv_decode_keep_op, NULL);
     }
 
   cpu->csr.misa = 0;
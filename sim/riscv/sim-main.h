@@ -25,6 +25,33 @@
 #include "machs.h"
 #include "sim-base.h"
 
+struct riscv_opcode;
+
+/* A predecoded instruction.  Compressed instructions are stored in their
+   expanded 32-bit form, so the execute routines only ever see one encoding;
+   LEN is the length of the original instruction for the pc update.  RAW is
+   the instruction as it was fetched, and is compared against memory on every
+   fetch so that a cached decode is never used after its code was rewritten,
+   whichever path (stores, syscalls, gdb breakpoints) did the writing.  */
+struct riscv_decoded_insn {
+  unsigned_word raw;
+  unsigned_word iw;
+  const struct riscv_opcode *op;
+  unsigned char len;
+  unsigned char rd, rs1, rs2;
+};
+
+/* The decode cache is direct-mapped by page, and every page holds a slot
+   for each halfword it contains.  Pages are allocated on first use.  */
+#define RISCV_INSN_CACHE_PAGE_SHIFT 12
+#define RISCV_INSN_CACHE_PAGE_SLOTS (1 << (RISCV_INSN_CACHE_PAGE_SHIFT - 1))
+#define RISCV_INSN_CACHE_PAGES 64
+
+struct riscv_insn_cache_page {
+  address_word tag;
+  struct riscv_decoded_insn insns[RISCV_INSN_CACHE_PAGE_SLOTS];
+};
+
 struct _sim_cpu {
   union {
     unsigned_word regs[32];
@@ -38,15 +65,17 @@ struct _sim_cpu {
       unsigned_word t3, t4, t5, t6;
     };
   };
+  /* The FP registers are always wide enough for the D extension; single
+     precision values are NaN-boxed.  */
   union {
-    unsigned_word fpregs[32];
+    uint64_t fpregs[32];
     struct {
       /* These are the ABI names.  */
-      unsigned_word ft0, ft1, ft2, ft3, ft4, ft5, ft6, ft7;
-      unsigned_word fs0, fs1;
-      unsigned_word fa0, fa1, fa2, fa3, fa4, fa5, fa6, fa7;
-      unsigned_word fs2, fs3, fs4, fs5, fs6, fs7, fs8, fs9, fs10, fs11;
-      unsigned_word ft8, ft9, ft10, ft11;
+      uint64_t ft0, ft1, ft2, ft3, ft4, ft5, ft6, ft7;
+      uint64_t fs0, fs1;
+      uint64_t fa0, fa1, fa2, fa3, fa4, fa5, fa6, fa7;
+      uint64_t fs2, fs3, fs4, fs5, fs6, fs7, fs8, fs9, fs10, fs11;
+      uint64_t ft8, ft9, ft10, ft11;
     };
   };
   sim_cia pc;
@@ -57,6 +86,8 @@ struct _sim_cpu {
 #undef DECLARE_CSR
   } csr;
 
+  struct riscv_insn_cache_page *insn_cache[RISCV_INSN_CACHE_PAGES];
+
   sim_cpu_base base;
 };
 
@@ -71,6 +102,9 @@ struct riscv_sim_state {
 };
 #define RISCV_SIM_STATE(sd) ((struct riscv_sim_state *) STATE_ARCH_DATA (sd))
 
+extern void riscv_sim_close (SIM_DESC, int);
+#define SIM_CLOSE_HOOK(...) riscv_sim_close (__VA_ARGS__)
+
 extern void step_once (SIM_CPU *);
 extern void initialize_cpu (SIM_DESC, SIM_CPU *, int);
 extern void initialize_env (SIM_DESC, const char * const *argv,
@@ -0,0 +1,39 @@
+# Check compressed instructions.
+# mach: riscv
+
+.include "testutils.inc"
+
+	.option rvc
+	start
+	c.li	a0, 5
+	c.addi	a0, 3
+	c.mv	a1, a0
+	c.slli	a1, 2
+	c.add	a0, a1
+	li	t0, 40
+	bne	a0, t0, .Lfail
+
+	# Stack-relative loads and stores.
+	c.addi16sp	sp, -16
+	c.swsp	a0, 4(sp)
+	c.lwsp	a2, 4(sp)
+	bne	a0, a2, .Lfail
+	c.addi16sp	sp, 16
+
+	# Branches and jumps; the link register must point past the
+	# 2-byte c.jalr.
+	c.beqz	a2, .Lfail
+	lla	t1, .Lsub
+	c.jalr	t1
+	li	t0, 41
+	bne	a0, t0, .Lfail
+
+	pass
+
+	.text
+.Lsub:
+	c.addi	a0, 1
+	c.jr	ra
+
+.Lfail:
+	fail
@@ -0,0 +1,56 @@
+# Check single and double precision FP instructions.
+# mach: riscv
+
+.include "testutils.inc"
+
+	start
+	# 3.0 * 4.0 = 12.0
+	li	t1, 3
+	fcvt.d.w	fa0, t1
+	li	t1, 4
+	fcvt.d.w	fa1, t1
+	fmul.d	fa2, fa0, fa1
+	fcvt.w.d	t2, fa2
+	li	t0, 12
+	bne	t2, t0, .Lfail
+
+	# Narrow to single precision and check the bits.
+	fcvt.s.d	ft0, fa2
+	fmv.x.w	t3, ft0
+	li	t0, 0x41400000
+	bne	t3, t0, .Lfail
+
+	# 12.0 + 1.0 = 13.0
+	li	t0, 0x3f800000
+	fmv.w.x	ft1, t0
+	fadd.s	ft2, ft0, ft1
+	fcvt.w.s	t2, ft2
+	li	t0, 13
+	bne	t2, t0, .Lfail
+
+	# Comparisons and classification.
+	flt.s	t2, ft1, ft0
+	beqz	t2, .Lfail
+	fclass.s	t2, ft1
+	li	t0, 1 << 6
+	bne	t2, t0, .Lfail
+
+	# 3.0 * 4.0 + 3.0 = 15.0
+	fmadd.d	fa4, fa0, fa1, fa0
+	fcvt.w.d	t2, fa4
+	li	t0, 15
+	bne	t2, t0, .Lfail
+
+	# Division by zero raises DZ.
+	fsflags	zero
+	fcvt.d.w	fa6, zero
+	fdiv.d	fa6, fa0, fa6
+	frflags	t2
+	li	t0, 0x08
+	bne	t2, t0, .Lfail
+
+	pass
+
+	.text
+.Lfail:
+	fail